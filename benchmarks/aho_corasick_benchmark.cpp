@@ -0,0 +1,88 @@
+// AC 自动机吞吐量随关键词数的变化：同一段英文风格文本上比较 AhoCorasick 单遍扫描
+// （全部匹配与最左最长）和对每个关键词分别调用 kmpSearch
+#include "algorithms/aho_corasick.h"
+#include "algorithms/string_algorithms.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using algorithms::AhoCorasick;
+
+// 由 4~9 个字母组成的随机"单词"，按 Zipf 频率拼成文本
+std::vector<std::string> makeVocabulary(std::size_t size, std::mt19937_64& gen) {
+    std::vector<std::string> words(size);
+    for (auto& w : words) {
+        w.resize(4 + gen() % 6);
+        for (char& c : w) c = static_cast<char>('a' + gen() % 26);
+    }
+    return words;
+}
+
+std::string makeText(const std::vector<std::string>& vocabulary, std::size_t length, std::mt19937_64& gen) {
+    std::string text;
+    text.reserve(length + 16);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    while (text.size() < length) {
+        double rank = std::pow(static_cast<double>(vocabulary.size()), unit(gen));
+        text += vocabulary[static_cast<std::size_t>(rank) - 1];
+        text.push_back(' ');
+    }
+    return text;
+}
+
+double mbPerSecond(std::chrono::steady_clock::time_point start, std::size_t bytes) {
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(bytes) / seconds / 1e6;
+}
+
+} // namespace
+
+int main() {
+    std::mt19937_64 gen(2024);
+    std::vector<std::string> vocabulary = makeVocabulary(20000, gen);
+    std::string text = makeText(vocabulary, 8u << 20, gen);
+    std::printf("文本: %zu 字节（MB/s）\n", text.size());
+    std::printf("%10s %10s %12s %14s %14s %12s\n", "keywords", "states", "matches", "ac-all", "ac-leftmost",
+                "kmp-each");
+
+    for (std::size_t keywords : {10u, 100u, 500u, 1000u, 5000u}) {
+        // 一半关键词取自词表（会命中），一半取词表单词的前缀（制造重叠匹配）
+        std::vector<std::string> patterns(keywords);
+        for (std::size_t k = 0; k < keywords; k++) {
+            const std::string& word = vocabulary[gen() % 2000];
+            patterns[k] = k % 2 == 0 ? word : word.substr(0, 3);
+        }
+        AhoCorasick ac(patterns);
+
+        auto start = std::chrono::steady_clock::now();
+        std::size_t matches = ac.count(text);
+        double all = mbPerSecond(start, text.size());
+
+        start = std::chrono::steady_clock::now();
+        std::size_t selected = ac.findAll(text, AhoCorasick::MatchKind::LeftmostLongest).size();
+        double leftmost = mbPerSecond(start, text.size());
+
+        // 关键词多时逐个 KMP 太慢，只扫描文本的一部分再换算
+        std::size_t kmpBytes = std::max<std::size_t>(text.size() / keywords, 64u << 10);
+        kmpBytes = std::min(kmpBytes, text.size());
+        std::string prefix = text.substr(0, kmpBytes);
+        start = std::chrono::steady_clock::now();
+        std::size_t kmpMatches = 0;
+        for (const auto& p : patterns) kmpMatches += algorithms::kmpSearch(prefix, p).size();
+        double kmp = mbPerSecond(start, prefix.size());
+        if (kmpMatches != ac.count(prefix) || selected > matches) {
+            std::fprintf(stderr, "结果不一致: keywords=%zu\n", keywords);
+            return 1;
+        }
+
+        std::printf("%10zu %10zu %12zu %14.1f %14.1f %12.2f\n", keywords, ac.stateCount(), matches, all, leftmost,
+                    kmp);
+    }
+    return 0;
+}
@@ -0,0 +1,159 @@
+// 大容量0-1背包各求解算法的对比：物品数 × 容量 × 价值范围，三类实例分别计时
+//
+// 显式指定的 Pareto 与 BranchAndBound 在困难实例上是指数时间，只在能跑完的规模上计时；
+// 两种 DP 只在表格不超过 2^29 格时计时。不适用的格子显示 "-"。
+#include "algorithms/dp_algorithms.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+using algorithms::KnapsackSolver;
+using algorithms::LargeKnapsackSolution;
+
+enum class Kind { Uncorrelated, Correlated, SubsetSum };
+
+const char* kindName(Kind kind) {
+    switch (kind) {
+        case Kind::Uncorrelated: return "random";
+        case Kind::Correlated: return "correlated";
+        default: return "subset-sum";
+    }
+}
+
+struct Instance {
+    std::vector<long long> weights;
+    std::vector<long long> values;
+    long long capacity;
+};
+
+// 重量均匀分布在 [1, 4·capacity/n]，约一半物品能放进背包
+Instance makeInstance(std::mt19937_64& gen, Kind kind, std::size_t n, long long capacity, long long valueRange) {
+    Instance instance{std::vector<long long>(n), std::vector<long long>(n), capacity};
+    long long maxWeight = std::max(4 * capacity / static_cast<long long>(n), 1LL);
+    for (std::size_t i = 0; i < n; i++) {
+        long long weight = 1 + static_cast<long long>(gen() % static_cast<unsigned long long>(maxWeight));
+        instance.weights[i] = weight;
+        switch (kind) {
+            case Kind::Uncorrelated:
+                instance.values[i] = 1 + static_cast<long long>(gen() % static_cast<unsigned long long>(valueRange));
+                break;
+            case Kind::Correlated:
+                // 价值与重量成正比再加固定偏移，密度接近，分支限界的上界很松
+                instance.values[i] = static_cast<long long>(static_cast<double>(weight) / maxWeight * valueRange * 0.9) +
+                                     valueRange / 10;
+                break;
+            case Kind::SubsetSum:
+                instance.values[i] = weight;
+                break;
+        }
+    }
+    return instance;
+}
+
+// 取多次运行中的最短耗时（毫秒）
+double bestMillis(const Instance& instance, KnapsackSolver solver, LargeKnapsackSolution& solution) {
+    double best = 1e300;
+    for (int round = 0; round < 3; round++) {
+        auto start = std::chrono::steady_clock::now();
+        solution = algorithms::knapsack01Large(instance.weights, instance.values, instance.capacity, solver);
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    return best;
+}
+
+// n * (range + 1) 不超过 limit
+bool tableFits(std::size_t n, long long range, unsigned long long limit) {
+    return static_cast<unsigned long long>(range) + 1 <= limit / n;
+}
+
+const char* solverName(KnapsackSolver solver) {
+    switch (solver) {
+        case KnapsackSolver::CapacityDP: return "capacity";
+        case KnapsackSolver::ValueDP: return "value";
+        case KnapsackSolver::Pareto: return "pareto";
+        case KnapsackSolver::BranchAndBound: return "bnb";
+        default: return "auto";
+    }
+}
+
+} // namespace
+
+int main() {
+    std::mt19937_64 gen(2024);
+    const unsigned long long DP_CELL_LIMIT = 1ULL << 29;
+
+    std::printf("%-10s %6s %12s %12s %11s %11s %11s %11s %11s %9s %10s\n", "kind", "n", "capacity", "values",
+                "capDP(ms)", "valueDP(ms)", "pareto(ms)", "bnb(ms)", "auto(ms)", "choice", "auto gap");
+    for (Kind kind : {Kind::Uncorrelated, Kind::Correlated, Kind::SubsetSum}) {
+        for (std::size_t n : {20u, 200u, 2000u}) {
+            for (long long capacity : {100000LL, 1000000000LL, 1000000000000LL}) {
+                for (long long valueRange : {1000LL, 1000000000LL}) {
+                    // 子集和实例的价值等于重量，价值范围不起作用
+                    if (kind == Kind::SubsetSum && valueRange != 1000LL) continue;
+                    Instance instance = makeInstance(gen, kind, n, capacity, valueRange);
+                    long long valueSum = 0;
+                    for (long long value : instance.values) valueSum += value;
+
+                    bool runs[4] = {
+                        tableFits(n, capacity, DP_CELL_LIMIT),
+                        tableFits(n, valueSum, DP_CELL_LIMIT),
+                        n <= 20 || (kind == Kind::Uncorrelated && n <= 200),
+                        n <= 20 || kind == Kind::Uncorrelated,
+                    };
+                    const KnapsackSolver exactSolvers[4] = {KnapsackSolver::CapacityDP, KnapsackSolver::ValueDP,
+                                                            KnapsackSolver::Pareto, KnapsackSolver::BranchAndBound};
+
+                    char cells[4][16];
+                    long long reference = -1;
+                    for (int s = 0; s < 4; s++) {
+                        std::snprintf(cells[s], sizeof(cells[s]), "%s", "-");
+                        if (!runs[s]) continue;
+                        LargeKnapsackSolution solution;
+                        double millis = bestMillis(instance, exactSolvers[s], solution);
+                        std::snprintf(cells[s], sizeof(cells[s]), "%.2f", millis);
+                        if (reference >= 0 && solution.maxValue != reference) {
+                            std::fprintf(stderr, "结果不一致: %s %lld != %lld\n", solverName(exactSolvers[s]),
+                                         solution.maxValue, reference);
+                            return 1;
+                        }
+                        reference = solution.maxValue;
+                    }
+
+                    LargeKnapsackSolution automatic;
+                    double autoMillis = bestMillis(instance, KnapsackSolver::Auto, automatic);
+                    if (reference >= 0 && (automatic.maxValue > reference ||
+                                           (automatic.optimal && automatic.maxValue != reference))) {
+                        std::fprintf(stderr, "结果不一致: auto %lld != %lld\n", automatic.maxValue, reference);
+                        return 1;
+                    }
+                    // 近似解与最优解（未知时用容量作上界，只对子集和实例有意义）的相对差距
+                    char gap[16] = "exact";
+                    if (!automatic.optimal) {
+                        long long bound = reference >= 0 ? reference : (kind == Kind::SubsetSum ? capacity : -1);
+                        if (bound == automatic.maxValue) {
+                            std::snprintf(gap, sizeof(gap), "%s", "0");
+                        } else if (bound > 0) {
+                            std::snprintf(gap, sizeof(gap), "%.1e",
+                                          static_cast<double>(bound - automatic.maxValue) / bound);
+                        } else {
+                            std::snprintf(gap, sizeof(gap), "%s", "approx");
+                        }
+                    }
+
+                    KnapsackSolver choice = algorithms::selectKnapsackSolver(instance.weights, instance.values,
+                                                                             instance.capacity);
+                    std::printf("%-10s %6zu %12lld %12lld %11s %11s %11s %11s %11.2f %9s %10s\n", kindName(kind), n,
+                                capacity, kind == Kind::SubsetSum ? 0LL : valueRange, cells[0], cells[1], cells[2],
+                                cells[3], autoMillis, solverName(choice), gap);
+                    std::fflush(stdout);
+                }
+            }
+        }
+    }
+    return 0;
+}
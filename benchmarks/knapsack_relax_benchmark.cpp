@@ -0,0 +1,90 @@
+// 0-1背包行松弛内核的指令集对比：同一组物品分别用标量、AVX2 与 AVX-512 更新 int32/int64 行
+#include "algorithms/detail/dp_kernels.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+using algorithms::detail::SimdLevel;
+
+struct Item {
+    std::size_t weight;
+    std::int64_t value;
+};
+
+// 依次放入所有物品，取多次运行中的最短耗时（毫秒）；row 与 taken 返回最后一次的结果
+template<typename T>
+double bestMillis(const std::vector<Item>& items, std::size_t capacity, bool recordTaken, SimdLevel level,
+                  std::vector<T>& row, std::vector<std::uint64_t>& taken) {
+    std::size_t rowWords = (capacity + 64) / 64;
+    double best = 1e300;
+    for (int round = 0; round < 5; round++) {
+        row.assign(capacity + 1, 0);
+        taken.assign(recordTaken ? items.size() * rowWords : 0, 0);
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < items.size(); i++) {
+            algorithms::detail::knapsackRelax(row.data(), capacity, items[i].weight,
+                                              static_cast<T>(items[i].value),
+                                              recordTaken ? &taken[i * rowWords] : nullptr, level);
+        }
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    return best;
+}
+
+// 打印一行对比；CPU 不支持的级别会被内核降级，显示为 "-"
+template<typename T>
+bool compareLevels(const char* type, const std::vector<Item>& items, std::size_t capacity, bool recordTaken) {
+    bool hasAvx512 = algorithms::detail::detectSimdLevel() >= SimdLevel::AVX512;
+    std::vector<T> scalarRow, avx2Row, avx512Row;
+    std::vector<std::uint64_t> scalarTaken, avx2Taken, avx512Taken;
+    double scalar = bestMillis(items, capacity, recordTaken, SimdLevel::Scalar, scalarRow, scalarTaken);
+    double avx2 = bestMillis(items, capacity, recordTaken, SimdLevel::AVX2, avx2Row, avx2Taken);
+    double avx512 = 0;
+    if (hasAvx512) {
+        avx512 = bestMillis(items, capacity, recordTaken, SimdLevel::AVX512, avx512Row, avx512Taken);
+    }
+    if (avx2Row != scalarRow || avx2Taken != scalarTaken ||
+        (hasAvx512 && (avx512Row != scalarRow || avx512Taken != scalarTaken))) {
+        std::fprintf(stderr, "结果不一致: %s capacity=%zu\n", type, capacity);
+        return false;
+    }
+
+    char avx512Cell[16] = "-";
+    char avx512Speedup[16] = "-";
+    if (hasAvx512) {
+        std::snprintf(avx512Cell, sizeof(avx512Cell), "%.3f", avx512);
+        std::snprintf(avx512Speedup, sizeof(avx512Speedup), "%.2fx", scalar / avx512);
+    }
+    std::printf("%6s %10zu %6zu %6s %12.3f %12.3f %12s %8.2fx %8s\n", type, capacity, items.size(),
+                recordTaken ? "yes" : "no", scalar, avx2, avx512Cell, scalar / avx2, avx512Speedup);
+    return true;
+}
+
+} // namespace
+
+int main() {
+    std::mt19937_64 gen(2024);
+    std::printf("检测到的指令集级别: %d（0 标量，1 SSE2，2 AVX2，3 AVX-512）\n",
+                static_cast<int>(algorithms::detail::detectSimdLevel()));
+    std::printf("%6s %10s %6s %6s %12s %12s %12s %9s %8s\n", "type", "capacity", "items", "taken", "scalar(ms)",
+                "avx2(ms)", "avx512(ms)", "avx2", "avx512");
+    for (std::size_t capacity : {1000u, 100000u, 1000000u}) {
+        // 重量均匀分布在 [1, capacity/2]，每个物品平均更新 3/4 行
+        std::vector<Item> items(64);
+        for (Item& item : items) {
+            item.weight = 1 + static_cast<std::size_t>(gen() % std::max<std::size_t>(capacity / 2, 1));
+            item.value = 1 + static_cast<std::int64_t>(gen() % 10000);
+        }
+        for (bool recordTaken : {false, true}) {
+            if (!compareLevels<std::int32_t>("int32", items, capacity, recordTaken)) return 1;
+            if (!compareLevels<std::int64_t>("int64", items, capacity, recordTaken)) return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+// 学习索引与二分查找对比：在 1 亿个已排序键上分别用 PiecewiseLinearIndex::lowerBound
+// 与 std::lower_bound 查找同一批随机目标
+#include "algorithms/learned_index.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+using algorithms::search::PiecewiseLinearIndex;
+
+// 均匀间隔：相邻键差在 [1, 30] 内均匀分布
+std::vector<int> uniformKeys(std::size_t n, std::mt19937_64& gen) {
+    std::vector<int> keys(n);
+    long long key = 0;
+    for (auto& k : keys) {
+        key += 1 + static_cast<long long>(gen() % 30);
+        k = static_cast<int>(key);
+    }
+    return keys;
+}
+
+// 分段不均：每 64K 个键换一次密度，模拟不同时段写入速率不同的时间戳
+std::vector<int> burstyKeys(std::size_t n, std::mt19937_64& gen) {
+    std::vector<int> keys(n);
+    long long key = 0;
+    std::uint64_t gap = 1;
+    for (std::size_t i = 0; i < n; i++) {
+        if (i % 65536 == 0) gap = 1 + gen() % 40;
+        key += 1 + static_cast<long long>(gen() % gap);
+        keys[i] = static_cast<int>(key);
+    }
+    return keys;
+}
+
+double nanosPerQuery(std::chrono::steady_clock::time_point start, std::size_t queries) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(queries);
+}
+
+void run(const char* name, const std::vector<int>& keys, std::mt19937_64& gen) {
+    const std::size_t queries = 5000000;
+    std::vector<int> targets(queries);
+    for (auto& t : targets) t = static_cast<int>(gen() % static_cast<std::uint64_t>(keys.back() + 1));
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t expected = 0;
+    for (int t : targets) expected += static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.end(), t) - keys.begin());
+    double binary = nanosPerQuery(start, queries);
+    std::printf("%-8s %8s %12s %12s %10s %12s %8s\n", name, "epsilon", "segments", "model(B)", "maxError",
+                "learned(ns)", "speedup");
+
+    for (int epsilon : {8, 16, 32, 64, 128}) {
+        PiecewiseLinearIndex index(keys, epsilon);
+        start = std::chrono::steady_clock::now();
+        std::size_t checksum = 0;
+        for (int t : targets) checksum += index.lowerBound(t);
+        double learned = nanosPerQuery(start, queries);
+        if (checksum != expected) {
+            std::fprintf(stderr, "结果不一致: epsilon=%d\n", epsilon);
+            std::exit(1);
+        }
+        std::printf("%-8s %8d %12zu %12zu %10d %12.1f %7.2fx\n", "", epsilon, index.segmentCount(),
+                    index.modelSizeBytes(), index.maxError(), learned, binary / learned);
+    }
+    std::printf("%-8s std::lower_bound %.1f ns/查询\n\n", "", binary);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 100000000;
+    std::mt19937_64 gen(2024);
+    std::printf("键数: %zu（%.0f MB）\n\n", n, static_cast<double>(n * sizeof(int)) / (1 << 20));
+
+    std::vector<int> keys = uniformKeys(n, gen);
+    run("uniform", keys, gen);
+    keys = burstyKeys(n, gen);
+    run("bursty", keys, gen);
+    return 0;
+}
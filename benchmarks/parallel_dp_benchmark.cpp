@@ -0,0 +1,71 @@
+// 波前并行DP的线程数对比：同一输入分别用 1、2、4、8 个线程计算，并与单线程串行实现对照
+#include "algorithms/dp_algorithms.h"
+#include "algorithms/parallel_dp.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::string randomString(std::mt19937_64& gen, std::size_t length, int alphabet) {
+    std::string s(length, 'a');
+    for (char& c : s) c = static_cast<char>('a' + static_cast<int>(gen() % alphabet));
+    return s;
+}
+
+// 取多次运行中的最短耗时（毫秒）
+template<typename Run>
+double bestMillis(Run run, int& result) {
+    double best = 1e300;
+    for (int round = 0; round < 3; round++) {
+        auto start = std::chrono::steady_clock::now();
+        result = run();
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    std::mt19937_64 gen(2024);
+    std::string a = randomString(gen, 100000, 4);
+    std::string b = randomString(gen, 100000, 4);
+    std::printf("输入: %zu x %zu，hardware_concurrency = %u\n", a.size(), b.size(),
+                std::thread::hardware_concurrency());
+
+    int serialLcs = 0, serialEdit = 0;
+    double lcsSerial = bestMillis([&] { return algorithms::longestCommonSubsequence(a, b); }, serialLcs);
+    std::string editA = a.substr(0, 20000), editB = b.substr(0, 20000);
+    double editSerial = bestMillis([&] { return algorithms::editDistance(editA, editB); }, serialEdit);
+    std::printf("串行 longestCommonSubsequence (100000 x 100000): %10.1f ms\n", lcsSerial);
+    int bitVectorEdit = 0;
+    double editBitVector = bestMillis([&] { return algorithms::parallelEditDistance(editA, editB, 1); }, bitVectorEdit);
+    std::printf("串行 editDistance (20000 x 20000):               %10.1f ms\n", editSerial);
+    std::printf("单线程 parallelEditDistance (20000 x 20000):     %10.1f ms\n", editBitVector);
+    if (bitVectorEdit != serialEdit) {
+        std::fprintf(stderr, "编辑距离结果不一致: %d != %d\n", bitVectorEdit, serialEdit);
+        return 1;
+    }
+
+    std::printf("%8s %22s %22s\n", "threads", "parallelLCS(ms)", "parallelEdit(ms)");
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        int lcs = 0, edit = 0;
+        double lcsTime = bestMillis([&] { return algorithms::parallelLongestCommonSubsequence(a, b, threads); }, lcs);
+        double editTime = bestMillis([&] { return algorithms::parallelEditDistance(a, b, threads); }, edit);
+        if (lcs != serialLcs) {
+            std::fprintf(stderr, "LCS 结果不一致: %d != %d\n", lcs, serialLcs);
+            return 1;
+        }
+        if (algorithms::parallelEditDistance(editA, editB, threads) != serialEdit) {
+            std::fprintf(stderr, "编辑距离结果不一致: threads=%u\n", threads);
+            return 1;
+        }
+        std::printf("%8u %22.1f %22.1f\n", threads, lcsTime, editTime);
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+// 并行子串查找的线程数对比：同一段文本分别用 1~32 个线程计数与收集全部匹配，
+// 并与单线程 countMatches 对照
+#include "algorithms/parallel_search.h"
+#include "algorithms/string_algorithms.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace {
+
+// 取多次运行中的最短耗时（毫秒）
+template<typename Run>
+double bestMillis(Run run, std::size_t& result) {
+    double best = 1e300;
+    for (int round = 0; round < 5; round++) {
+        auto start = std::chrono::steady_clock::now();
+        result = run();
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main() {
+    // 256 MB 小写字母文本，模式每隔约 4 KB 出现一次
+    std::mt19937_64 gen(2024);
+    std::string text(256u << 20, 'a');
+    for (char& c : text) c = static_cast<char>('a' + gen() % 26);
+    const std::string pattern = "needle";
+    for (std::size_t pos = gen() % 4096; pos + pattern.size() < text.size(); pos += 1 + gen() % 8192) {
+        text.replace(pos, pattern.size(), pattern);
+    }
+
+    std::size_t expected = 0;
+    double serial = bestMillis([&] { return algorithms::countMatches(text, pattern); }, expected);
+    double gigabytes = static_cast<double>(text.size()) / 1e9;
+    std::printf("文本: %zu 字节，匹配: %zu，hardware_concurrency = %u\n", text.size(), expected,
+                std::thread::hardware_concurrency());
+    std::printf("单线程 countMatches: %.1f ms（%.2f GB/s）\n", serial, gigabytes / (serial / 1e3));
+    std::printf("%8s %12s %10s %12s %10s\n", "threads", "count(ms)", "GB/s", "findAll(ms)", "GB/s");
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u}) {
+        std::size_t counted = 0, collected = 0;
+        double count = bestMillis([&] { return algorithms::parallelCountMatches(text, pattern, threads); }, counted);
+        double findAll = bestMillis([&] { return algorithms::parallelFindAll(text, pattern, threads).size(); },
+                                    collected);
+        if (counted != expected || collected != expected) {
+            std::fprintf(stderr, "结果不一致: threads=%u\n", threads);
+            return 1;
+        }
+        std::printf("%8u %12.1f %10.2f %12.1f %10.2f\n", threads, count, gigabytes / (count / 1e3), findAll,
+                    gigabytes / (findAll / 1e3));
+    }
+    return 0;
+}
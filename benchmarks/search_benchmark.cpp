@@ -0,0 +1,95 @@
+// 插值查找族对比：在均匀、Zipf、聚簇三种分布上比较 adaptiveInterpolationSearch、
+// interpolationSearch 与 binarySearch 的单次查询耗时
+#include "algorithms/search.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int MAX_KEY = 1 << 30;
+
+std::vector<int> uniformKeys(std::size_t n, std::mt19937_64& gen) {
+    std::vector<int> keys(n);
+    for (auto& k : keys) k = static_cast<int>(gen() % MAX_KEY);
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+// Zipf：第 r 名的值约为 MAX_KEY / r，小值极密、大值极疏
+std::vector<int> zipfKeys(std::size_t n, std::mt19937_64& gen) {
+    std::vector<int> keys(n);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (auto& k : keys) {
+        double rank = std::pow(static_cast<double>(n), unit(gen));  // 对数均匀的名次
+        k = static_cast<int>(MAX_KEY / rank);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+// 聚簇：16 个相距很远的窄簇
+std::vector<int> clusteredKeys(std::size_t n, std::mt19937_64& gen) {
+    std::vector<int> keys(n);
+    for (auto& k : keys) {
+        int cluster = static_cast<int>(gen() % 16);
+        k = cluster * (MAX_KEY / 16) + static_cast<int>(gen() % 100000);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+// 一半查询命中已有键，一半为随机值
+std::vector<int> makeQueries(const std::vector<int>& keys, std::size_t count, std::mt19937_64& gen) {
+    std::vector<int> queries(count);
+    for (std::size_t i = 0; i < count; i++) {
+        queries[i] = i % 2 == 0 ? keys[gen() % keys.size()] : static_cast<int>(gen() % MAX_KEY);
+    }
+    return queries;
+}
+
+template<typename Search>
+double nanosPerQuery(Search search, const std::vector<int>& keys, const std::vector<int>& queries,
+                     std::size_t& found) {
+    found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int q : queries) found += search(keys, q) >= 0 ? 1 : 0;
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(queries.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 10000000;
+    const std::size_t queryCount = 200000;
+    std::mt19937_64 gen(2024);
+    std::printf("键数: %zu，查询数: %zu（ns/查询）\n", n, queryCount);
+    std::printf("%-10s %14s %14s %14s\n", "分布", "binary", "interpolation", "adaptive");
+
+    struct Distribution {
+        const char* name;
+        std::vector<int> (*make)(std::size_t, std::mt19937_64&);
+    };
+    const Distribution distributions[] = {{"uniform", uniformKeys}, {"zipf", zipfKeys}, {"clustered", clusteredKeys}};
+    for (const auto& dist : distributions) {
+        std::vector<int> keys = dist.make(n, gen);
+        std::vector<int> queries = makeQueries(keys, queryCount, gen);
+
+        std::size_t binaryFound = 0, interpolationFound = 0, adaptiveFound = 0;
+        double binary = nanosPerQuery(algorithms::search::binarySearch, keys, queries, binaryFound);
+        double interpolation =
+            nanosPerQuery(algorithms::search::interpolationSearch, keys, queries, interpolationFound);
+        double adaptive = nanosPerQuery(algorithms::search::adaptiveInterpolationSearch, keys, queries, adaptiveFound);
+        if (binaryFound != interpolationFound || binaryFound != adaptiveFound) {
+            std::fprintf(stderr, "结果不一致: %s\n", dist.name);
+            return 1;
+        }
+        std::printf("%-10s %14.1f %14.1f %14.1f\n", dist.name, binary, interpolation, adaptive);
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+// 单模式查找算法对比：英文、DNA、二进制三类文本以及 Horspool 的最坏情况（全 a 文本上
+// 查找 a..aba..a）中，按模式长度比较 KMP、Horspool、Two-Way 与 Auto（selectSearchAlgorithm）
+// 的吞吐量，用于校准选择阈值
+#include "algorithms/string_algorithms.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using algorithms::StringSearchAlgorithm;
+
+// 常用英文单词按 Zipf 频率拼接
+std::string englishText(std::size_t length, std::mt19937_64& gen) {
+    static const char* const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it", "as", "was", "with", "be", "by",
+        "on", "not", "he", "this", "are", "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her", "has", "there", "been", "if",
+        "more", "when", "will", "would", "who", "so", "no", "time", "people", "search", "algorithm",
+        "pattern", "string", "between", "through", "structure", "performance", "memory", "question",
+        "government", "development", "information", "international", "something", "important"};
+    const std::size_t count = sizeof(words) / sizeof(words[0]);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::string text;
+    text.reserve(length + 16);
+    while (text.size() < length) {
+        double rank = std::pow(static_cast<double>(count), unit(gen));
+        text += words[static_cast<std::size_t>(rank) - 1];
+        text.push_back(gen() % 12 == 0 ? '.' : ' ');
+    }
+    return text;
+}
+
+std::string dnaText(std::size_t length, std::mt19937_64& gen) {
+    std::string text(length, 'A');
+    for (char& c : text) c = "ACGT"[gen() % 4];
+    return text;
+}
+
+// 类似可执行文件：一半是 0 字节，其余集中在少数操作码与随机字节
+std::string binaryText(std::size_t length, std::mt19937_64& gen) {
+    std::string text(length, '\0');
+    for (char& c : text) {
+        std::uint64_t r = gen() % 4;
+        c = r < 2 ? '\0' : (r == 2 ? static_cast<char>("\x48\x89\xe5\xff"[gen() % 4]) : static_cast<char>(gen()));
+    }
+    return text;
+}
+
+std::string periodicText(std::size_t length, std::mt19937_64&) {
+    return std::string(length, 'a');
+}
+
+const char* algorithmName(StringSearchAlgorithm algorithm) {
+    switch (algorithm) {
+        case StringSearchAlgorithm::KMP: return "kmp";
+        case StringSearchAlgorithm::Horspool: return "horspool";
+        case StringSearchAlgorithm::TwoWay: return "twoway";
+        default: return "auto";
+    }
+}
+
+// 对同一长度的若干模式（取自文本，保证有匹配）求总吞吐量（MB/s）
+double throughput(const std::string& text, const std::vector<std::string>& patterns,
+                  StringSearchAlgorithm algorithm, std::size_t& matches) {
+    matches = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& p : patterns) matches += algorithms::stringSearch(text, p, algorithm).size();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(text.size() * patterns.size()) / seconds / 1e6;
+}
+
+} // namespace
+
+int main() {
+    std::mt19937_64 gen(2024);
+    struct Corpus {
+        const char* name;
+        std::string text;
+        bool adversarial;  ///< 模式改为 a..aba..a
+    };
+    const std::size_t length = 4u << 20;
+    const Corpus corpora[] = {{"english", englishText(length, gen), false},
+                              {"dna", dnaText(length, gen), false},
+                              {"binary", binaryText(length, gen), false},
+                              {"periodic", periodicText(length, gen), true}};
+    const StringSearchAlgorithm algorithms_[] = {StringSearchAlgorithm::KMP, StringSearchAlgorithm::Horspool,
+                                                 StringSearchAlgorithm::TwoWay, StringSearchAlgorithm::Auto};
+
+    std::printf("每类文本 %zu 字节，每个长度 16 个模式（MB/s）\n", length);
+    for (const auto& corpus : corpora) {
+        std::printf("\n%-8s %6s %10s %10s %10s %10s   %s\n", corpus.name, "m", "kmp", "horspool", "twoway",
+                    "auto", "auto 选择");
+        for (std::size_t m : {2u, 3u, 4u, 6u, 8u, 16u, 32u, 64u}) {
+            std::vector<std::string> patterns(16);
+            for (auto& p : patterns) p = corpus.text.substr(gen() % (corpus.text.size() - m), m);
+            if (corpus.adversarial) {
+                // 最后一个字节总能对上，每个窗口都要比较到中间的 b 才失配，且每次只移动 1
+                for (auto& p : patterns) p[m / 2 - (m > 2 ? 0 : 1)] = 'b';
+            }
+
+            std::printf("%-8s %6zu", "", m);
+            std::size_t expected = 0;
+            for (StringSearchAlgorithm algorithm : algorithms_) {
+                std::size_t matches = 0;
+                double speed = throughput(corpus.text, patterns, algorithm, matches);
+                if (algorithm == StringSearchAlgorithm::KMP) expected = matches;
+                if (matches != expected) {
+                    std::fprintf(stderr, "结果不一致: %s m=%zu\n", corpus.name, m);
+                    return 1;
+                }
+                std::printf(" %10.1f", speed);
+            }
+            std::printf("   %s\n", algorithmName(algorithms::selectSearchAlgorithm(patterns[0])));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+#ifndef ALGORITHMS_AHO_CORASICK_H
+#define ALGORITHMS_AHO_CORASICK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace algorithms {
+
+/**
+ * @brief 多模式匹配的一次命中
+ */
+struct PatternMatch {
+    std::size_t patternId;  ///< 模式在构造参数中的下标
+    std::size_t position;   ///< 匹配在文本中的起始位置
+
+    bool operator==(const PatternMatch& other) const {
+        return patternId == other.patternId && position == other.position;
+    }
+};
+
+/**
+ * @brief Aho-Corasick 多模式匹配自动机
+ *
+ * 构造时一次性编译全部模式：先建 trie，再按 BFS 计算失败链接，并把缺失的
+ * 转移补全为完整的 DFA，匹配时每个文本字符只做一次查表。转移表是稠密的
+ * 二维数组，但只为模式中出现过的字节分配列（其余字节共用一列，直接回到
+ * 根状态），因此几千个关键词的自动机也能保持紧凑、缓存友好。
+ *
+ * 与对每个模式分别调用 kmpSearch 相比，文本只需扫描一遍。
+ *
+ * @note 构建时间复杂度: O(M * σ)，M 为模式总长，σ 为模式中出现的不同字节数
+ * @note 匹配时间复杂度: O(n + z)，z 为匹配数量；LeftmostLongest 模式同样单遍扫描，
+ *       额外内存只有最长模式长度大小的窗口
+ * @note 空间复杂度: O(M * σ)
+ * @note 空模式被忽略，永远不会匹配（与 kmpSearch 一致）
+ *
+ * @example
+ * algorithms::AhoCorasick ac({"he", "she", "his", "hers"});
+ * auto matches = ac.findAll("ushers");
+ * // matches: {1, 1} ("she"), {0, 2} ("he"), {3, 2} ("hers")
+ */
+class AhoCorasick {
+public:
+    /// 匹配语义
+    enum class MatchKind {
+        All,             ///< 报告所有（可重叠的）匹配，按结束位置排序
+        LeftmostLongest  ///< 从左到右选取不重叠的匹配，同一起点取最长模式
+    };
+
+    /**
+     * @brief 编译模式集合
+     * @param patterns 模式列表，patternId 即其下标
+     */
+    explicit AhoCorasick(const std::vector<std::string>& patterns);
+
+    /**
+     * @brief 单遍扫描文本，对每个匹配调用 visit(patternId, position)
+     * @param text 文本
+     * @param visit 回调，position 为匹配起始位置
+     * @note 匹配按结束位置升序报告，结束位置相同时较长的模式先报告
+     */
+    template<typename Visitor>
+    void forEachMatch(std::string_view text, Visitor&& visit) const {
+        std::int32_t state = 0;
+        for (std::size_t i = 0; i < text.size(); i++) {
+            unsigned char c = static_cast<unsigned char>(text[i]);
+            state = delta_[static_cast<std::size_t>(state) * stride_ + byteClass_[c]];
+            for (std::int32_t s = firstOutput_[state]; s != NO_STATE; s = outputLink_[s]) {
+                for (std::int32_t k = outputStart_[s]; k < outputStart_[s + 1]; k++) {
+                    std::size_t id = static_cast<std::size_t>(outputs_[k]);
+                    visit(id, i + 1 - patternLengths_[id]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 查找所有匹配
+     * @param text 文本
+     * @param kind 匹配语义
+     * @return 匹配列表；All 模式按结束位置排序，LeftmostLongest 模式按起始位置排序
+     */
+    std::vector<PatternMatch> findAll(std::string_view text, MatchKind kind = MatchKind::All) const;
+
+    /**
+     * @brief 统计匹配数量（所有可重叠匹配）
+     */
+    std::size_t count(std::string_view text) const;
+
+    std::size_t patternCount() const noexcept { return patternLengths_.size(); }
+    std::size_t stateCount() const noexcept { return firstOutput_.size(); }
+
+    /// 转移表列数（模式中出现的不同字节数 + 1）
+    std::size_t alphabetSize() const noexcept { return stride_; }
+
+    /// 自动机占用的字节数
+    std::size_t memoryBytes() const noexcept;
+
+private:
+    static constexpr std::int32_t NO_STATE = -1;
+
+    std::size_t stride_;
+    std::uint16_t byteClass_[256];
+    std::vector<std::int32_t> delta_;         ///< 稠密转移表，stateCount x stride_
+    std::vector<std::int32_t> firstOutput_;   ///< 状态自身或失败链上第一个有输出的状态
+    std::vector<std::int32_t> outputLink_;    ///< 失败链上下一个有输出的状态
+    std::vector<std::int32_t> outputStart_;   ///< CSR 偏移，outputs_[outputStart_[s] .. outputStart_[s+1])
+    std::vector<std::int32_t> outputs_;       ///< 各状态结束的模式编号
+    std::vector<std::size_t> patternLengths_;
+    std::size_t maxPatternLength_;            ///< 最长模式长度，LeftmostLongest 的滑动窗口大小
+};
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_AHO_CORASICK_H
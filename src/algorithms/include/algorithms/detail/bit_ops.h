@@ -0,0 +1,49 @@
+#ifndef ALGORITHMS_DETAIL_BIT_OPS_H
+#define ALGORITHMS_DETAIL_BIT_OPS_H
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace algorithms {
+namespace detail {
+
+/**
+ * @brief 统计 64 位整数中 1 的个数
+ */
+inline unsigned popcount64(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<unsigned>(__popcnt64(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return static_cast<unsigned>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief 最高位 1 的位置（x 不能为 0）
+ */
+inline unsigned highestBit64(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return static_cast<unsigned>(index);
+#else
+    unsigned n = 0;
+    while (x >>= 1) n++;
+    return n;
+#endif
+}
+
+} // namespace detail
+} // namespace algorithms
+
+#endif // ALGORITHMS_DETAIL_BIT_OPS_H
@@ -0,0 +1,108 @@
+#ifndef ALGORITHMS_DETAIL_BIT_PARALLEL_LCS_H
+#define ALGORITHMS_DETAIL_BIT_PARALLEL_LCS_H
+
+#include "algorithms/detail/cpu_features.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace algorithms {
+namespace detail {
+
+/**
+ * @brief 位并行 LCS（Allison-Dix / Hyyrö）
+ *
+ * 以列字符串的每个位置为一位，为每个出现的字节预先建立匹配位掩码 M[c]。
+ * 行字符串每读入一个字符 c，状态向量按
+ *     V = (V + (V & M[c])) | (V & ~M[c])
+ * 更新一次，跨字的加法进位逐字传递。处理完全部行字符后，V 在前 j 位中
+ * 0 的个数就是 LCS(行, 列[0..j)) 的长度。
+ *
+ * 除字节串外也支持稠密整数编号的序列（例如驻留后的行或记号）。
+ *
+ * AVX2 版本采用斜排布局：4 个 64 位通道依次处理相邻的 4 个字，第 k 个通道在
+ * 第 s 步处理第 s - k 行，因此每个通道的进位在下一步才传给上一个通道，
+ * 不需要跨通道的串行加法；最低通道的进位来自上一组字，最高通道的进位留给下一组。
+ *
+ * @note 时间复杂度: O(m·⌈n/64⌉)，空间复杂度: O(σ·⌈n/64⌉)，σ 为列序列中不同符号数
+ */
+class BitParallelLcs {
+public:
+    /**
+     * @brief 为列字符串建立匹配位掩码
+     */
+    explicit BitParallelLcs(std::string_view columns);
+
+    /**
+     * @brief 为整数编号序列建立匹配位掩码
+     * @param columns 列序列，每个编号必须小于 alphabetSize
+     * @param n 列序列长度
+     * @param alphabetSize 编号范围
+     */
+    BitParallelLcs(const std::uint32_t* columns, std::size_t n, std::size_t alphabetSize);
+
+    /**
+     * @brief 计算 LCS(rows, columns) 的长度
+     */
+    std::size_t length(std::string_view rows) const;
+
+    /**
+     * @brief 计算整数编号行序列与列序列的 LCS 长度（编号必须小于构造时的 alphabetSize）
+     */
+    std::size_t length(const std::uint32_t* rows, std::size_t m) const;
+
+    /**
+     * @brief 读入 rows 的全部字符，更新状态向量的前 words 个字
+     *
+     * 进位只向高位传递，因此只维护前 words 个字时，前 64 * words 位的结果
+     * 与维护完整向量时相同。第 j 位为 1 表示 LCS(行, 列[0..j]) 与
+     * LCS(行, 列[0..j)) 相等。
+     *
+     * @param v 状态向量，初值全 1 对应空的行字符串
+     * @param words 维护的字数（不超过 words()）
+     * @param rows 依次读入的行字符
+     * @param level 使用的指令集级别（会被限制在 CPU 支持的范围内）
+     */
+    void advance(std::uint64_t* v, std::size_t words, std::string_view rows,
+                 SimdLevel level = detectSimdLevel()) const noexcept;
+
+    /**
+     * @brief 只更新第 [wordBegin, wordEnd) 个字，跨分块的进位逐行传入传出
+     *
+     * 供分块并行使用：读入 rows[i] 时 carries[i] 为从第 wordBegin 个字之下传入的
+     * 进位，返回时改为第 wordEnd - 1 个字向上传出的进位。按列分块依次调用的结果
+     * 与一次 advance 相同。
+     */
+    void advanceWords(std::uint64_t* v, std::size_t wordBegin, std::size_t wordEnd,
+                      std::string_view rows, std::uint8_t* carries) const noexcept;
+
+    /**
+     * @brief 由状态向量得到 LCS(行, columns) 的长度（前 n 位中 0 的个数）
+     */
+    std::size_t lengthFromState(const std::uint64_t* v) const noexcept;
+
+    /// 列字符串长度
+    std::size_t columns() const noexcept { return n_; }
+
+    /// 完整状态向量的字数
+    std::size_t words() const noexcept { return words_; }
+
+private:
+    template<typename Symbol>
+    void build(const Symbol* columns);
+
+    template<typename Symbol>
+    void advanceSymbols(std::uint64_t* v, std::size_t words, const Symbol* rows, std::size_t m,
+                        SimdLevel level) const noexcept;
+
+    std::size_t n_;
+    std::size_t words_;
+    std::vector<std::int32_t> slot_;    // 符号 -> 掩码编号，-1 表示不在列序列中
+    std::vector<std::uint64_t> masks_;    // 编号 s 的掩码位于 [s * words_, (s + 1) * words_)
+};
+
+} // namespace detail
+} // namespace algorithms
+
+#endif // ALGORITHMS_DETAIL_BIT_PARALLEL_LCS_H
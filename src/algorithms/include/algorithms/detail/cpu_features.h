@@ -0,0 +1,50 @@
+#ifndef ALGORITHMS_DETAIL_CPU_FEATURES_H
+#define ALGORITHMS_DETAIL_CPU_FEATURES_H
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ALGORITHMS_ARCH_X86 1
+#else
+#define ALGORITHMS_ARCH_X86 0
+#endif
+
+// GCC/Clang 需要为使用更高指令集内建函数的函数单独标注目标；MSVC 不需要
+#if ALGORITHMS_ARCH_X86 && (defined(__GNUC__) || defined(__clang__))
+#define ALGORITHMS_TARGET_AVX2 __attribute__((target("avx2")))
+#define ALGORITHMS_TARGET_AVX512BW __attribute__((target("avx512f,avx512bw")))
+#else
+#define ALGORITHMS_TARGET_AVX2
+#define ALGORITHMS_TARGET_AVX512BW
+#endif
+
+namespace algorithms {
+namespace detail {
+
+/**
+ * @brief SIMD 指令集级别（从低到高排列，可直接比较大小）
+ */
+enum class SimdLevel {
+    Scalar = 0,  ///< 无 SIMD
+    SSE2 = 1,    ///< 128 位（x86-64 基线）
+    AVX2 = 2,    ///< 256 位
+    AVX512 = 3   ///< 512 位（AVX-512F + AVX-512BW）
+};
+
+/**
+ * @brief 运行时检测当前 CPU 支持的最高 SIMD 级别
+ * @return 检测结果（首次调用时检测并缓存）
+ * @note 非 x86 平台始终返回 SimdLevel::Scalar
+ */
+SimdLevel detectSimdLevel() noexcept;
+
+/**
+ * @brief 将请求的级别限制在 CPU 实际支持的范围内
+ */
+inline SimdLevel clampSimdLevel(SimdLevel requested) noexcept {
+    SimdLevel supported = detectSimdLevel();
+    return requested < supported ? requested : supported;
+}
+
+} // namespace detail
+} // namespace algorithms
+
+#endif // ALGORITHMS_DETAIL_CPU_FEATURES_H
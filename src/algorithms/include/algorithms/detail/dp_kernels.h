@@ -0,0 +1,51 @@
+#ifndef ALGORITHMS_DETAIL_DP_KERNELS_H
+#define ALGORITHMS_DETAIL_DP_KERNELS_H
+
+#include "algorithms/detail/cpu_features.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace algorithms {
+namespace detail {
+
+/**
+ * @brief 位集原地移位或：bits |= bits << shift
+ *
+ * 子集和的核心操作。从高位字向低位字处理，读取的低位字总是尚未更新的旧值，
+ * 因此可以原地完成；AVX2 版本一次处理 4 个字。
+ *
+ * @param bits 位集（bit i 在 bits[i / 64] 的第 i % 64 位）
+ * @param words 需要更新的字数（只更新 bits[0 .. words)）
+ * @param shift 移位量（位）
+ * @param level 使用的指令集级别（会被限制在 CPU 支持的范围内）
+ */
+void shiftOrBitset(std::uint64_t* bits, std::size_t words, std::size_t shift, SimdLevel level) noexcept;
+
+/**
+ * @brief 0-1背包单个物品的一行松弛：dp[w] = max(dp[w], dp[w - weight] + value)
+ *
+ * 对 w = capacity .. weight 从大到小更新。按向量块从高到低处理时，每块的源
+ * dp[w - weight] 都位于当前块或更低处，读取时尚未被本物品更新，因此任意
+ * weight 都可以直接向量化：int32 使用 vpmaxsd，int64 在 AVX2 上用
+ * 比较 + 混合、在 AVX-512 上用 vpmaxsq。
+ *
+ * @param dp 长度为 capacity + 1 的行
+ * @param capacity 背包容量
+ * @param weight 物品重量（大于 capacity 时不做任何更新）
+ * @param value 物品价值
+ * @param takenRow 可选的选择位图（capacity + 1 位）：放入物品使 dp[w] 严格增大时置位，可为 nullptr
+ * @param level 使用的指令集级别（会被限制在 CPU 支持的范围内）
+ */
+void knapsackRelax(std::int32_t* dp, std::size_t capacity, std::size_t weight, std::int32_t value,
+                   std::uint64_t* takenRow, SimdLevel level) noexcept;
+
+/**
+ * @brief knapsackRelax 的 64 位版本，用于总价值超出 int 范围的情形
+ */
+void knapsackRelax(std::int64_t* dp, std::size_t capacity, std::size_t weight, std::int64_t value,
+                   std::uint64_t* takenRow, SimdLevel level) noexcept;
+
+} // namespace detail
+} // namespace algorithms
+
+#endif // ALGORITHMS_DETAIL_DP_KERNELS_H
@@ -0,0 +1,84 @@
+#ifndef ALGORITHMS_DETAIL_PARALLEL_CHUNKS_H
+#define ALGORITHMS_DETAIL_PARALLEL_CHUNKS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace algorithms {
+namespace detail {
+
+/**
+ * @brief 根据工作量和请求的线程数确定实际使用的线程数
+ * @param items 待划分的元素个数（例如候选起始位置数）
+ * @param requested 请求的线程数，0 表示 hardware_concurrency()
+ * @param minPerThread 每个线程至少分到的元素个数
+ */
+inline unsigned resolveThreadCount(std::size_t items, unsigned requested, std::size_t minPerThread) {
+    if (requested == 0) {
+        requested = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::size_t byLength = std::max<std::size_t>(1, items / std::max<std::size_t>(1, minPerThread));
+    return static_cast<unsigned>(std::min<std::size_t>(requested, byLength));
+}
+
+/**
+ * @brief 把 [0, items) 平均分成 chunks 块并行处理
+ *
+ * 第 t 块为 [items*t/chunks, items*(t+1)/chunks)，调用 work(t, begin, end)。
+ * 第 0 块在调用线程上执行；任一块抛出的异常在所有线程结束后重新抛出。
+ * 创建线程失败时等待已启动的线程结束后重新抛出该异常。
+ */
+template<typename Work>
+void runChunks(std::size_t items, unsigned chunks, Work& work) {
+    auto bounds = [&](unsigned t, std::size_t& begin, std::size_t& end) {
+        begin = items * t / chunks;
+        end = items * (t + 1) / chunks;
+    };
+
+    std::vector<std::exception_ptr> errors(chunks);
+    std::vector<std::thread> workers;
+    try {
+        workers.reserve(chunks - 1);
+        for (unsigned t = 1; t < chunks; t++) {
+            workers.emplace_back([&, t]() {
+                try {
+                    std::size_t begin, end;
+                    bounds(t, begin, end);
+                    work(t, begin, end);
+                } catch (...) {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+    } catch (...) {
+        // 创建线程失败（std::system_error 或 bad_alloc）：先等已启动的线程结束，
+        // 否则销毁仍可 join 的 std::thread 会调用 std::terminate
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        throw;
+    }
+
+    try {
+        std::size_t begin, end;
+        bounds(0, begin, end);
+        work(0u, begin, end);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+} // namespace detail
+} // namespace algorithms
+
+#endif // ALGORITHMS_DETAIL_PARALLEL_CHUNKS_H
@@ -0,0 +1,47 @@
+#ifndef ALGORITHMS_DETAIL_SIMD_SEARCH_H
+#define ALGORITHMS_DETAIL_SIMD_SEARCH_H
+
+#include "algorithms/detail/cpu_features.h"
+#include <cstddef>
+
+namespace algorithms {
+namespace detail {
+
+/// 匹配回调：返回 false 时停止扫描
+using MatchCallback = bool (*)(void* context, std::size_t position);
+
+/**
+ * @brief 首尾字节过滤的向量化子串扫描
+ *
+ * 将模式首字节和尾字节广播到向量寄存器，一次比较 16/32/64 个候选起点，
+ * 只有首尾字节都相等的候选才用 memcmp 校验中间部分。按起始位置升序
+ * 报告所有（可重叠的）匹配。
+ *
+ * @param text 文本
+ * @param n 文本长度
+ * @param pattern 模式
+ * @param m 模式长度（为 0 时不报告任何匹配）
+ * @param level 使用的指令集级别（会被限制在 CPU 支持的范围内）
+ * @param onMatch 匹配回调
+ * @param context 传给回调的上下文指针
+ */
+void simdScan(const char* text, std::size_t n, const char* pattern, std::size_t m,
+              SimdLevel level, MatchCallback onMatch, void* context);
+
+/**
+ * @brief simdScan 的可调用对象版本，onMatch(position) 返回 false 时停止
+ */
+template<typename OnMatch>
+void simdScan(const char* text, std::size_t n, const char* pattern, std::size_t m,
+              SimdLevel level, OnMatch& onMatch) {
+    simdScan(text, n, pattern, m, level,
+             [](void* context, std::size_t position) {
+                 return (*static_cast<OnMatch*>(context))(position);
+             },
+             &onMatch);
+}
+
+} // namespace detail
+} // namespace algorithms
+
+#endif // ALGORITHMS_DETAIL_SIMD_SEARCH_H
@@ -0,0 +1,60 @@
+#ifndef ALGORITHMS_DETAIL_TOKEN_INTERNER_H
+#define ALGORITHMS_DETAIL_TOKEN_INTERNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace algorithms {
+namespace detail {
+
+/**
+ * @brief 把任意可哈希的记号映射为稠密的 uint32 编号
+ *
+ * 相同的记号得到相同的编号，编号按首次出现的顺序从 0 开始分配。序列比较的
+ * 内层循环因此只比较整数，长记号（例如整行文本）只在驻留时哈希和比较一次。
+ *
+ * @tparam T 记号类型（std::string_view 时调用方需保证原始数据存活）
+ */
+template<typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class TokenInterner {
+public:
+    /**
+     * @brief 返回记号的编号，首次出现时分配新编号
+     * @throw std::length_error 如果不同记号超过 2^32 个
+     */
+    std::uint32_t intern(const T& token) {
+        auto it = ids_.find(token);
+        if (it != ids_.end()) return it->second;
+        if (ids_.size() > UINT32_MAX) {
+            throw std::length_error("不同记号的数量超出 uint32 范围");
+        }
+        auto id = static_cast<std::uint32_t>(ids_.size());
+        ids_.emplace(token, id);
+        return id;
+    }
+
+    /**
+     * @brief 驻留整个序列，返回对应的编号序列
+     */
+    template<typename It>
+    std::vector<std::uint32_t> internAll(It first, It last) {
+        std::vector<std::uint32_t> ids;
+        for (; first != last; ++first) ids.push_back(intern(*first));
+        return ids;
+    }
+
+    /// 已分配的编号个数（字母表大小）
+    std::size_t size() const noexcept { return ids_.size(); }
+
+private:
+    std::unordered_map<T, std::uint32_t, Hash, KeyEqual> ids_;
+};
+
+} // namespace detail
+} // namespace algorithms
+
+#endif // ALGORITHMS_DETAIL_TOKEN_INTERNER_H
@@ -0,0 +1,59 @@
+#ifndef ALGORITHMS_DETAIL_WAVEFRONT_H
+#define ALGORITHMS_DETAIL_WAVEFRONT_H
+
+#include "algorithms/detail/parallel_chunks.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace algorithms {
+namespace detail {
+
+/**
+ * @brief 按反对角线波前并行执行 rows x cols 个分块
+ *
+ * 分块 (r, c) 依赖左侧 (r, c-1) 和上方 (r-1, c)。每个线程动态领取一整行分块，
+ * 从左到右依次执行，执行 (r, c) 前等待第 r-1 行已完成 c+1 块。各行因此形成
+ * 流水线，同一时刻执行中的分块大致位于同一条反对角线上，不需要全局屏障。
+ * 完成计数使用 release/acquire，上一行写入的边界数据对下一行可见。
+ *
+ * @param rows 分块行数
+ * @param cols 分块列数
+ * @param threads 线程数（>= 1）
+ * @param tile 分块函数 tile(r, c)，不能抛出异常（否则等待它的线程无法结束）
+ */
+template<typename Tile>
+void runWavefront(std::size_t rows, std::size_t cols, unsigned threads, Tile& tile) {
+    if (rows == 0 || cols == 0) return;
+    if (threads <= 1 || rows == 1) {
+        for (std::size_t r = 0; r < rows; r++) {
+            for (std::size_t c = 0; c < cols; c++) tile(r, c);
+        }
+        return;
+    }
+
+    std::unique_ptr<std::atomic<std::size_t>[]> done(new std::atomic<std::size_t>[rows]);
+    for (std::size_t r = 0; r < rows; r++) done[r].store(0, std::memory_order_relaxed);
+    std::atomic<std::size_t> nextRow(0);
+
+    auto work = [&](unsigned, std::size_t, std::size_t) {
+        for (std::size_t r = nextRow.fetch_add(1); r < rows; r = nextRow.fetch_add(1)) {
+            for (std::size_t c = 0; c < cols; c++) {
+                if (r > 0) {
+                    while (done[r - 1].load(std::memory_order_acquire) <= c) {
+                        std::this_thread::yield();
+                    }
+                }
+                tile(r, c);
+                done[r].store(c + 1, std::memory_order_release);
+            }
+        }
+    };
+    runChunks(rows, static_cast<unsigned>(threads < rows ? threads : rows), work);
+}
+
+} // namespace detail
+} // namespace algorithms
+
+#endif // ALGORITHMS_DETAIL_WAVEFRONT_H
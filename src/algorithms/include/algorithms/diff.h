@@ -0,0 +1,103 @@
+#ifndef ALGORITHMS_DIFF_H
+#define ALGORITHMS_DIFF_H
+
+#include "algorithms/detail/token_interner.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace algorithms {
+
+/**
+ * @brief 编辑脚本中一段操作的类型
+ */
+enum class DiffOp {
+    Equal,   ///< 两个序列中相同的一段
+    Delete,  ///< 只在旧序列中出现（被删除）
+    Insert   ///< 只在新序列中出现（被插入）
+};
+
+/**
+ * @brief 编辑脚本中的一段连续操作
+ *
+ * Equal 对应旧序列 [oldStart, oldStart + length) 与新序列 [newStart, newStart + length)；
+ * Delete 对应旧序列 [oldStart, oldStart + length)，newStart 为它在新序列中的位置；
+ * Insert 对应新序列 [newStart, newStart + length)，oldStart 为它在旧序列中的位置。
+ */
+struct DiffEdit {
+    DiffOp op;
+    std::size_t oldStart;
+    std::size_t newStart;
+    std::size_t length;
+
+    bool operator==(const DiffEdit& other) const {
+        return op == other.op && oldStart == other.oldStart && newStart == other.newStart &&
+               length == other.length;
+    }
+};
+
+/**
+ * @brief Myers O((N + M) * D) 差分算法（整数记号）
+ * 
+ * 先去掉公共前缀和后缀，再从两端同时沿对角线贪心延伸，找到最短编辑路径的
+ * 中间蛇形（middle snake），在分割点处递归处理两半。只保存两条对角线前沿，
+ * 因此输入只差几处时几乎是线性时间，且任何情况下都只占线性内存。
+ * 
+ * @param oldSeq 旧序列
+ * @param newSeq 新序列
+ * @return 编辑脚本：按位置顺序排列，相邻段的类型不同，插入和删除的总长度最小
+ * 
+ * @note 时间复杂度: O((N + M) * D)，D 为最少插入加删除次数
+ * @note 空间复杂度: O(N + M)
+ * 
+ * @example
+ * auto script = algorithms::myersDiff({1, 2, 3}, {1, 3, 4});
+ * // {Equal 0 0 1}, {Delete 1 1 1}, {Equal 2 1 1}, {Insert 3 2 1}
+ */
+std::vector<DiffEdit> myersDiff(const std::vector<std::uint32_t>& oldSeq,
+                                const std::vector<std::uint32_t>& newSeq);
+
+/**
+ * @brief 任意可哈希记号序列的差分
+ * 
+ * 先用 TokenInterner 把记号驻留为稠密整数，再调用 myersDiff，
+ * 因此长记号只在驻留时比较一次。
+ */
+template<typename T, typename Hash = std::hash<T>>
+std::vector<DiffEdit> diffSequences(const std::vector<T>& oldSeq, const std::vector<T>& newSeq) {
+    detail::TokenInterner<T, Hash> interner;
+    std::vector<std::uint32_t> oldIds = interner.internAll(oldSeq.begin(), oldSeq.end());
+    std::vector<std::uint32_t> newIds = interner.internAll(newSeq.begin(), newSeq.end());
+    return myersDiff(oldIds, newIds);
+}
+
+/**
+ * @brief 逐字符比较两个字符串
+ */
+std::vector<DiffEdit> diffStrings(std::string_view oldText, std::string_view newText);
+
+/**
+ * @brief 按行拆分文本（支持 \n 和 \r\n；末尾没有换行的最后一行也算一行）
+ * @return 不含换行符的各行，指向原文本
+ */
+std::vector<std::string_view> splitLines(std::string_view text);
+
+/**
+ * @brief 逐行比较两段文本，DiffEdit 中的位置和长度以行为单位
+ * 
+ * @example
+ * auto script = algorithms::diffLines("a\nb\nc\n", "a\nc\nd\n");
+ * // {Equal 0 0 1}, {Delete 1 1 1}, {Equal 2 1 1}, {Insert 3 2 1}
+ */
+std::vector<DiffEdit> diffLines(std::string_view oldText, std::string_view newText);
+
+/**
+ * @brief 编辑脚本的编辑距离（插入和删除的总长度）
+ */
+std::size_t diffDistance(const std::vector<DiffEdit>& script);
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_DIFF_H
@@ -21,11 +21,12 @@ namespace algorithms {
  * @throw std::invalid_argument 如果weights和values数组大小不一致
  * @throw std::invalid_argument 如果capacity为负数
  * @throw std::invalid_argument 如果capacity过大（>100000）
+ * @throw std::invalid_argument 如果某个物品重量为负数
  * 
  * @note 前置条件: weights.size() == values.size()
  * @note 前置条件: capacity >= 0 且 capacity <= 100000
  * @note 时间复杂度: O(n * capacity)，其中n是物品数量
- * @note 空间复杂度: O(n * capacity)
+ * @note 空间复杂度: O(capacity)（单行滚动数组，按容量从大到小更新）
  * 
  * @example
  * std::vector<int> weights = {2, 3, 4, 5};
@@ -36,6 +37,161 @@ namespace algorithms {
  */
 int knapsack01(const std::vector<int>& weights, const std::vector<int>& values, int capacity);
 
+/**
+ * @brief 0-1背包问题的解：最大价值及选中的物品
+ */
+struct KnapsackSolution {
+    int maxValue;                   ///< 最大总价值
+    std::vector<int> selectedItems; ///< 选中物品的下标（升序）
+    bool optimal = true;            ///< 是否为最优解；只有Auto用尽搜索预算时为false
+};
+
+/**
+ * @brief 求解0-1背包问题并给出选中的物品
+ * 
+ * 与knapsack01使用同一个单行滚动数组，另外为每个(物品, 容量)记录1位选择标记：
+ * 放入该物品是否使该容量下的价值严格增大。求解后从最大容量倒序回溯标记即可
+ * 得到选中的物品，标记位图只占 n * (capacity + 1) / 8 字节。
+ * 
+ * @param weights 物品重量数组
+ * @param values 物品价值数组
+ * @param capacity 背包的最大承重容量
+ * @return 最大价值和选中物品的下标；选中物品的总价值等于maxValue，总重量不超过capacity
+ * 
+ * @throw std::invalid_argument 输入校验规则与knapsack01相同
+ * 
+ * @note 时间复杂度: O(n * capacity)
+ * @note 空间复杂度: O(capacity) 个整数 + n * capacity 位
+ * 
+ * @example
+ * std::vector<int> weights = {2, 3, 4, 5};
+ * std::vector<int> values = {3, 4, 5, 6};
+ * algorithms::KnapsackSolution solution = algorithms::knapsack01WithItems(weights, values, 8);
+ * // solution.maxValue is 10, solution.selectedItems is {1, 3}
+ */
+KnapsackSolution knapsack01WithItems(const std::vector<int>& weights, const std::vector<int>& values,
+                                     int capacity);
+
+/**
+ * @brief 子集和判定：能否选出若干物品使重量之和恰好等于target
+ * 
+ * 只关心可行性时不需要knapsack01的整数表格：用位集表示所有可达的重量和，
+ * 每个物品执行一次 reachable |= reachable << weight，一次字运算处理64个容量，
+ * 在支持AVX2的CPU上一次处理256个。一旦target可达即提前返回。
+ * 
+ * @param weights 物品重量数组（重量为0的物品不影响结果）
+ * @param target 目标重量和
+ * @return 存在重量和恰好为target的子集时返回true（target为0时总是true）
+ * 
+ * @throw std::invalid_argument 如果target或某个物品重量为负数
+ * 
+ * @note 时间复杂度: O(n * target / 64)
+ * @note 空间复杂度: O(target / 64) 个字
+ * 
+ * @example
+ * std::vector<int> weights = {3, 34, 4, 12, 5, 2};
+ * bool ok = algorithms::subsetSum(weights, 9);   // true (4 + 5)
+ * bool no = algorithms::subsetSum(weights, 30);  // false
+ */
+bool subsetSum(const std::vector<int>& weights, int target);
+
+/**
+ * @brief 求不超过capacity的最大可达子集重量和
+ * 
+ * 与subsetSum使用相同的位集，最后从capacity向下找第一个可达的和。
+ * 
+ * @param weights 物品重量数组
+ * @param capacity 容量上限
+ * @return 不超过capacity的最大子集重量和（空集为0）
+ * 
+ * @throw std::invalid_argument 如果capacity或某个物品重量为负数
+ * 
+ * @note 时间复杂度: O(n * capacity / 64)
+ * @note 空间复杂度: O(capacity / 64) 个字
+ * 
+ * @example
+ * int best = algorithms::closestSubsetSum({6, 9, 14}, 22);  // 20 (6 + 14)
+ */
+int closestSubsetSum(const std::vector<int>& weights, int capacity);
+
+/**
+ * @brief 大容量0-1背包的求解算法
+ */
+enum class KnapsackSolver {
+    Auto,           ///< 由selectKnapsackSolver根据规模自动选择
+    CapacityDP,     ///< 按容量的动态规划，O(n * capacity)
+    ValueDP,        ///< 按价值的动态规划（每个价值的最小重量），O(n * 总价值)
+    Pareto,         ///< 稀疏Pareto前沿（支配表）动态规划，与容量和价值范围无关
+    BranchAndBound  ///< 分支限界，以分数背包松弛作为上界
+};
+
+/**
+ * @brief 大容量0-1背包问题的解
+ */
+struct LargeKnapsackSolution {
+    long long maxValue;             ///< 最大总价值
+    std::vector<int> selectedItems; ///< 选中物品的下标（升序）
+    bool optimal = true;            ///< 是否为最优解；只有Auto用尽搜索预算时为false
+};
+
+/**
+ * @brief 根据物品数、容量和价值范围选择求解算法
+ * 
+ * 规则（按顺序）：
+ * - n * capacity 与 n * 总价值中较小者不超过约1.3亿格时，用对应的CapacityDP或ValueDP
+ * - 物品不超过20个时，用Pareto（前沿大小不超过2^n）
+ * - 否则用BranchAndBound；由knapsack01Large自动选择时限定搜索规模，见其说明
+ * 
+ * @param weights 物品重量数组
+ * @param values 物品价值数组
+ * @param capacity 背包容量
+ * @return 推荐的求解算法（不会返回Auto）
+ * @throw std::invalid_argument 输入校验规则与knapsack01Large相同
+ */
+KnapsackSolver selectKnapsackSolver(const std::vector<long long>& weights,
+                                    const std::vector<long long>& values, long long capacity);
+
+/**
+ * @brief 不受容量上限限制的0-1背包求解
+ * 
+ * knapsack01要求capacity <= 100000，而容量规划等场景的容量可达数十亿、物品只有几百个。
+ * 本函数提供几种时间不随容量增长的算法，并且都能给出选中的物品：
+ * - ValueDP：dp[v]为恰好得到价值v的最小重量，适合价值较小的情形
+ * - Pareto：只保留不被支配的（重量, 价值）状态，状态数与容量无关
+ * - BranchAndBound：按价值密度排序深度优先搜索，用分数背包的贪心解作为上界剪枝
+ * 
+ * 价值不为正的物品和重量超过容量的物品会被预先剔除。
+ * 
+ * 显式指定的算法总是给出最优解，但Pareto与BranchAndBound在困难实例上（如重量等于
+ * 价值的子集和问题）是指数时间。Auto选中BranchAndBound时只展开约400万个结点，
+ * 未完成则依次尝试表格不超过约10亿格的CapacityDP/ValueDP、处理约400万个状态以内的
+ * Pareto；仍未完成时把价值按比例缩小到DP表格不超过约1.3亿格，求近似解并与分支限界
+ * 已找到的最好解取较好者，此时optimal为false。因此Auto的耗时有上界（单核约1秒量级）。
+ * 
+ * @param weights 物品重量数组
+ * @param values 物品价值数组
+ * @param capacity 背包的最大承重容量
+ * @param solver 求解算法，默认自动选择
+ * @return 最大价值和选中物品的下标
+ * 
+ * @throw std::invalid_argument 如果weights和values数组大小不一致
+ * @throw std::invalid_argument 如果capacity或某个物品重量为负数
+ * @throw std::invalid_argument 如果正价值物品的总价值超出long long范围
+ * @throw std::invalid_argument 如果指定CapacityDP或ValueDP但表格规模过大（超过约40亿格）
+ * 
+ * @note 时间复杂度: 取决于算法；显式指定的Pareto与BranchAndBound最坏为指数级
+ * @note 空间复杂度: DP为一行整数 + 每格1位；Pareto为前沿状态总数
+ * 
+ * @example
+ * std::vector<long long> weights = {4000000000LL, 3000000000LL, 2000000000LL};
+ * std::vector<long long> values = {40, 33, 25};
+ * auto solution = algorithms::knapsack01Large(weights, values, 5000000000LL);
+ * // solution.maxValue is 58, solution.selectedItems is {1, 2}
+ */
+LargeKnapsackSolution knapsack01Large(const std::vector<long long>& weights,
+                                      const std::vector<long long>& values, long long capacity,
+                                      KnapsackSolver solver = KnapsackSolver::Auto);
+
 /**
  * @brief 计算两个字符串的最长公共子序列（LCS）的长度
  * 
@@ -46,8 +202,9 @@ int knapsack01(const std::vector<int>& weights, const std::vector<int>& values,
  * @param s2 第二个字符串
  * @return 最长公共子序列的长度
  * 
- * @note 时间复杂度: O(m * n)，其中m和n分别是两个字符串的长度
- * @note 空间复杂度: O(m * n)
+ * @note 使用位并行算法（Allison-Dix / Hyyrö），一次机器字运算处理 64 个DP格
+ * @note 时间复杂度: O(max(m, n) * ⌈min(m, n) / 64⌉)，其中m和n分别是两个字符串的长度
+ * @note 空间复杂度: O(σ * min(m, n) / 64)，σ为较短字符串中不同字符的个数
  * @note 应用场景: 文件对比、DNA序列比对等
  * 
  * @example
@@ -64,13 +221,18 @@ int longestCommonSubsequence(const std::string& s1, const std::string& s2);
  * 不仅计算LCS的长度，还通过回溯DP表构造出实际的最长公共子序列字符串。
  * 如果存在多个相同长度的LCS，返回其中一个。
  * 
+ * 不保存完整的DP表：按行二分，只保存各层分割行的位并行状态向量，
+ * 先回溯下半部分求出路径穿过中间行的列，再回溯上半部分；行数足够少时
+ * 保存整块状态向量直接回溯。
+ * 
  * @param s1 第一个字符串
  * @param s2 第二个字符串
  * @return 最长公共子序列字符串
  * 
- * @note 时间复杂度: O(m * n)，其中m和n分别是两个字符串的长度
- * @note 空间复杂度: O(m * n)
- * @note 如果有多个LCS，返回字典序最小的一个（取决于实现）
+ * @note 时间复杂度: O(m * n / 64 * log m)，其中m和n分别是两个字符串的长度
+ * @note 空间复杂度: O(m + n / 64 * log m)
+ * @note 回溯规则与完整DP表相同：字符相等时走对角线，否则在不损失长度时优先
+ *       减小 j，因此结果与逐格回溯完全一致
  * 
  * @example
  * std::string s1 = "ABCDGH";
@@ -80,6 +242,27 @@ int longestCommonSubsequence(const std::string& s1, const std::string& s2);
  */
 std::string getLongestCommonSubsequence(const std::string& s1, const std::string& s2);
 
+/**
+ * @brief 计算两个字符串的编辑距离（Levenshtein 距离）
+ * 
+ * 把s1变成s2所需的最少单字符插入、删除、替换次数。
+ * dp[i][j] = min(dp[i-1][j-1] + (s1[i-1] != s2[j-1]), dp[i-1][j] + 1, dp[i][j-1] + 1)，
+ * 只保留一行。
+ * 
+ * @param s1 第一个字符串
+ * @param s2 第二个字符串
+ * @return 编辑距离
+ * 
+ * @note 时间复杂度: O(m * n)
+ * @note 空间复杂度: O(min(m, n))
+ * @note 大输入可使用 parallel_dp.h 中的 parallelEditDistance
+ * 
+ * @example
+ * int d = algorithms::editDistance("kitten", "sitting");
+ * // d is 3
+ */
+int editDistance(const std::string& s1, const std::string& s2);
+
 } // namespace algorithms
 
 #endif // ALGORITHMS_DP_ALGORITHMS_H
\ No newline at end of file
@@ -0,0 +1,178 @@
+#ifndef ALGORITHMS_FM_INDEX_H
+#define ALGORITHMS_FM_INDEX_H
+
+#include "algorithms/mapped_search.h"
+#include "algorithms/suffix_array.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace algorithms {
+
+/**
+ * @brief FM 索引（BWT + Huffman 形小波树 + 采样后缀数组）压缩全文索引
+ * 
+ * 在后缀数组的基础上求出文本的 Burrows-Wheeler 变换（BWT），并用按字符频率
+ * 建立 Huffman 编码的小波树支持 BWT 上的 rank(c, i) 查询：每个字符在树中走过的
+ * 层数等于它的编码长度，常见字符路径短，BWT 部分的总位数约为 n·(H0 + 1)。
+ * 计数使用反向查找（backward search）：从模式末尾逐字符缩小后缀区间，
+ * 每个字符只需两次 rank，与文本长度无关。定位时沿 LF 映射回退到最近的采样行，
+ * 再加上回退步数。
+ * 
+ * 索引不保存原文本，空间与时间的权衡如下（n 为文本长度，H0 为按字节的零阶熵，
+ * s 为采样间隔）：
+ * - BWT（小波树）：n·H0 位左右（最多 n·(H0 + 1) 位），rank 目录另加约 3%；
+ *   DNA 约 2.1 位/字符，英文约 4.7～5.3 位/字符
+ * - 采样标记位向量：n·(1 + 1/32) 位
+ * - 采样后缀数组：32·n/s 位；s 越大越省空间，但 locate 每个结果平均多走 s/2 步 LF
+ * 
+ * 默认 s = 32 时英文文本约 7～7.4 位/字符，小于原文本。count 的时间为 O(m·H0)，
+ * locate 每个结果额外 O(s·H0)。
+ * 
+ * 索引可以保存为单个按 64 位字对齐的二进制文件，load() 读入内存，map() 直接
+ * 内存映射文件，启动时不需要重建也不需要复制数据。文件使用本机字节序；
+ * 加载时校验头部的累计计数、编码表和树结构与文件长度一致，损坏的文件抛出异常。
+ * 
+ * @example
+ * algorithms::FMIndex index("abracadabra");
+ * index.count("abra");      // 2
+ * index.locate("abra");     // {0, 7}
+ * index.save("corpus.fmi");
+ * algorithms::FMIndex mapped = algorithms::FMIndex::map("corpus.fmi");
+ */
+class FMIndex {
+public:
+    /// 默认的后缀数组采样间隔
+    static constexpr std::size_t DEFAULT_SAMPLE_RATE = 32;
+
+    /**
+     * @brief 由文本构建 FM 索引（内部先构建后缀数组）
+     * @param text 文本
+     * @param sampleRate 后缀数组采样间隔
+     * @throw std::invalid_argument 如果 sampleRate 为 0
+     * @throw std::length_error 如果文本长度超过 SuffixArray::MAX_TEXT_LENGTH
+     */
+    explicit FMIndex(std::string_view text, std::size_t sampleRate = DEFAULT_SAMPLE_RATE);
+
+    /**
+     * @brief 由已有的后缀数组构建 FM 索引
+     * @param suffixArray 后缀数组索引
+     * @param sampleRate 后缀数组采样间隔
+     * @throw std::invalid_argument 如果 sampleRate 为 0
+     */
+    explicit FMIndex(const SuffixArray& suffixArray, std::size_t sampleRate = DEFAULT_SAMPLE_RATE);
+
+    FMIndex(const FMIndex&) = delete;
+    FMIndex& operator=(const FMIndex&) = delete;
+    FMIndex(FMIndex&&) noexcept = default;
+    FMIndex& operator=(FMIndex&&) noexcept = default;
+
+    /**
+     * @brief 统计模式的出现次数（包括重叠出现）
+     * @return 出现次数；模式为空时返回 0
+     */
+    std::size_t count(std::string_view pattern) const;
+
+    /**
+     * @brief 查找模式的所有出现位置
+     * @return 升序排列的起始位置
+     * @throw std::runtime_error 如果索引文件的采样标记已损坏
+     */
+    std::vector<std::size_t> locate(std::string_view pattern) const;
+
+    /**
+     * @brief 获取原文本长度
+     */
+    std::size_t textLength() const noexcept { return static_cast<std::size_t>(textLength_); }
+
+    /**
+     * @brief 获取实际出现的字节种类数 σ
+     */
+    std::size_t alphabetSize() const noexcept { return static_cast<std::size_t>(alphabetSize_); }
+
+    /**
+     * @brief 获取后缀数组采样间隔
+     */
+    std::size_t sampleRate() const noexcept { return static_cast<std::size_t>(sampleRate_); }
+
+    /**
+     * @brief 获取索引数据的大小（字节），即 save() 写出的文件大小
+     */
+    std::size_t sizeInBytes() const noexcept { return wordCount_ * sizeof(std::uint64_t); }
+
+    /**
+     * @brief 保存索引到二进制文件
+     * @throw std::runtime_error 如果文件无法写入
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief 把索引文件读入内存
+     * @throw std::runtime_error 如果文件无法读取或格式不正确
+     */
+    static FMIndex load(const std::string& path);
+
+    /**
+     * @brief 内存映射索引文件，查询直接访问映射内存
+     * @throw std::runtime_error 如果文件无法映射或格式不正确
+     */
+    static FMIndex map(const std::string& path);
+
+private:
+    FMIndex() = default;
+
+    void build(const SuffixArray& suffixArray, std::size_t sampleRate);
+    void attach(const std::uint64_t* data, std::size_t wordCount, const std::string& path);
+
+    // 带 rank 目录的位向量在 data_ 中的偏移（以 64 位字为单位）
+    struct RankedBits {
+        std::size_t bits = 0;
+        std::size_t superblocks = 0;
+        std::size_t blocks = 0;
+    };
+
+    // 小波树内部结点：在树位向量中的区间、区间之前 1 的个数、两个孩子
+    struct TreeNode {
+        std::size_t start = 0;
+        std::size_t length = 0;
+        std::size_t onesBefore = 0;
+        std::uint32_t child[2] = {0, 0};
+    };
+
+    // 位向量前 i 位里 1 的个数
+    std::size_t rank1(const RankedBits& vector, std::size_t i) const noexcept;
+    bool bit(std::size_t bitsOffset, std::size_t i) const noexcept;
+    // 结点序列前 pos 位里 1 的个数
+    std::size_t nodeRank1(const TreeNode& node, std::size_t pos) const noexcept;
+    // BWT 前 i 行中编码为 code 的字符个数
+    std::size_t rank(std::size_t code, std::size_t i) const noexcept;
+    std::size_t accessCode(std::size_t row) const noexcept;
+    // LF 映射：第 row 行的前一个字符所在的行
+    std::size_t lastToFirst(std::size_t row) const noexcept;
+
+    std::vector<std::uint64_t> owned_;
+    std::unique_ptr<search::MappedFile> mapping_;
+    const std::uint64_t* data_ = nullptr;
+    std::size_t wordCount_ = 0;
+
+    // 从头部解析出的标量、小波树结构和各段的偏移
+    std::uint64_t textLength_ = 0;
+    std::uint64_t alphabetSize_ = 0;
+    std::uint64_t sampleRate_ = 0;
+    std::uint64_t dollarRow_ = 0;
+    std::uint64_t sampleCount_ = 0;
+    std::array<std::int16_t, 256> codeOf_{};
+    std::vector<std::uint64_t> huffman_;
+    std::vector<TreeNode> nodes_;
+    RankedBits tree_;
+    RankedBits marks_;
+    std::size_t samples_ = 0;
+};
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_FM_INDEX_H
@@ -0,0 +1,105 @@
+#ifndef ALGORITHMS_LEARNED_INDEX_H
+#define ALGORITHMS_LEARNED_INDEX_H
+
+#include <cstddef>
+#include <vector>
+
+namespace algorithms {
+namespace search {
+
+/**
+ * @brief 分段线性学习索引（PGM 风格，误差上界为 epsilon）
+ *
+ * 将已排序数组的 "键 -> 位置" 映射用若干线性段近似，每段保证对段内所有
+ * 不同键的位置预测误差不超过 epsilon。查找时先在段首键上二分定位线性段，
+ * 用线性模型预测位置，再在 [pred - epsilon, pred + epsilon] 的小窗口内
+ * 完成二分查找。对分段均匀（如时间戳、自增ID）的数据，段数远小于键数，
+ * 模型内存远小于 B 树的内部节点。
+ *
+ * @note 索引不持有数据，只保存指向 keys 的指针；keys 在索引生命周期内
+ *       必须保持有效且不被修改
+ * @note 构建时间复杂度: O(n)（单趟收缩锥算法）
+ * @note 查找时间复杂度: O(log s + log epsilon)，s 为段数
+ * @note 空间复杂度: O(s)
+ *
+ * @example
+ * std::vector<int> keys = {1, 2, 3, 10, 20, 30, 1000, 2000};
+ * algorithms::search::PiecewiseLinearIndex index(keys, 2);
+ * int pos = index.find(20);            // pos is 4
+ * std::size_t lb = index.lowerBound(15); // lb is 4
+ */
+class PiecewiseLinearIndex {
+public:
+    /// 默认误差上界
+    static constexpr int DEFAULT_EPSILON = 32;
+
+    /**
+     * @brief 在已排序数组上构建学习索引
+     * @param keys 已按升序排序的键（允许重复）
+     * @param epsilon 位置预测的最大误差，必须为正数
+     * @throw std::invalid_argument 如果 epsilon <= 0
+     */
+    explicit PiecewiseLinearIndex(const std::vector<int>& keys, int epsilon = DEFAULT_EPSILON);
+
+    /// 索引只保存指向 keys 的指针，禁止绑定到临时数组（否则构造完立即悬空）
+    PiecewiseLinearIndex(std::vector<int>&& keys, int epsilon = DEFAULT_EPSILON) = delete;
+
+    /**
+     * @brief 查找目标值
+     * @param target 要查找的目标值
+     * @return 目标值首次出现的索引，未找到返回-1
+     */
+    int find(int target) const;
+
+    /**
+     * @brief 返回第一个不小于 target 的元素位置
+     * @param target 目标值
+     * @return 位置索引，所有元素都小于 target 时返回 size()
+     */
+    std::size_t lowerBound(int target) const;
+
+    /**
+     * @brief 获取索引覆盖的键数量
+     */
+    std::size_t size() const noexcept { return keys_->size(); }
+
+    /**
+     * @brief 获取线性段数量
+     */
+    std::size_t segmentCount() const noexcept { return segments_.size(); }
+
+    /**
+     * @brief 获取模型占用的字节数（不含被索引的数据本身）
+     */
+    std::size_t modelSizeBytes() const noexcept;
+
+    /**
+     * @brief 获取构建时设定的误差上界
+     */
+    int epsilon() const noexcept { return epsilon_; }
+
+    /**
+     * @brief 获取构建时实测的最大预测误差（不超过 epsilon()）
+     */
+    int maxError() const noexcept { return maxError_; }
+
+private:
+    /// 线性段：pos(key) ≈ startPos + slope * (key - firstKey)
+    struct Segment {
+        int firstKey;
+        double slope;
+        std::size_t startPos;
+    };
+
+    std::size_t predict(const Segment& seg, std::size_t segEnd, int target) const;
+
+    const std::vector<int>* keys_;
+    std::vector<Segment> segments_;
+    int epsilon_;
+    int maxError_;
+};
+
+} // namespace search
+} // namespace algorithms
+
+#endif // ALGORITHMS_LEARNED_INDEX_H
@@ -0,0 +1,278 @@
+#ifndef ALGORITHMS_MAPPED_SEARCH_H
+#define ALGORITHMS_MAPPED_SEARCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace algorithms {
+namespace search {
+
+/**
+ * @brief 只读内存映射文件（RAII）
+ *
+ * POSIX 平台使用 mmap，Windows 平台使用 CreateFileMapping/MapViewOfFile。
+ * 映射在对象析构时解除。空文件不建立映射，data() 返回 nullptr。
+ *
+ * @throw std::runtime_error 如果文件无法打开或映射
+ */
+class MappedFile {
+public:
+    /// 访问模式提示，对应 madvise/posix_madvise 的建议值
+    enum class AccessPattern {
+        Normal,     ///< 默认预读策略
+        Random,     ///< 随机访问（关闭预读，适合查找）
+        Sequential, ///< 顺序访问（加大预读，适合扫描）
+        WillNeed    ///< 预先加载到页缓存
+    };
+
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const unsigned char* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief 向操作系统提示访问模式（不支持的平台上为空操作）
+     * @param pattern 访问模式
+     */
+    void advise(AccessPattern pattern) const noexcept;
+
+private:
+    void release() noexcept;
+
+    const unsigned char* data_;
+    std::size_t size_;
+#ifdef _WIN32
+    void* fileHandle_;
+    void* mappingHandle_;
+#else
+    int fd_;
+#endif
+};
+
+/**
+ * @brief 基于内存映射文件的已排序数组视图
+ *
+ * 文件内容为定宽小端序整数键（升序），查找时直接访问映射内存，
+ * 无需先读入 std::vector。提供与 search.h 相同的查找族：
+ * 二分查找、（自适应）插值查找，以及可选的内存顶层索引。
+ *
+ * 顶层索引对每个数据块（默认一页）的首键采样，并按 Eytzinger（BFS）
+ * 布局存放在内存中；查找先在顶层索引中定位数据块，再只在该块内二分，
+ * 因此一次查找最多触及映射文件的一到两页。
+ *
+ * @tparam T 键类型（8/16/32/64 位整数）
+ *
+ * @note 位置使用 std::size_t，可以寻址超过 2^31 个键
+ * @note 时间复杂度: 二分 O(log n)；带顶层索引时 O(log(n/B) + log B)，磁盘页访问 O(1)
+ * @note 空间复杂度: 无顶层索引时 O(1)；有顶层索引时 O(n/B)
+ *
+ * @example
+ * algorithms::search::MappedSortedArray<std::uint64_t> keys("ids.bin");
+ * keys.adviseRandom();
+ * keys.buildTopLevelIndex();
+ * std::size_t pos = keys.binarySearch(42);  // 未找到时为 npos
+ */
+template<typename T>
+class MappedSortedArray {
+    static_assert(std::is_integral<T>::value, "MappedSortedArray 只支持整数键");
+
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// 默认数据块大小（字节），与常见页大小一致
+    static constexpr std::size_t DEFAULT_BLOCK_BYTES = 4096;
+
+    /**
+     * @brief 映射键文件
+     * @param path 文件路径
+     * @throw std::runtime_error 如果文件无法打开或映射
+     * @throw std::invalid_argument 如果文件大小不是 sizeof(T) 的整数倍
+     */
+    explicit MappedSortedArray(const std::string& path)
+        : file_(path), size_(file_.size() / sizeof(T)), blockSize_(0), eytzinger_(), blockRank_() {
+        if (file_.size() % sizeof(T) != 0) {
+            throw std::invalid_argument("文件大小不是键宽度的整数倍: " + path);
+        }
+    }
+
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief 读取第 i 个键（按小端序解码）
+     */
+    T operator[](std::size_t i) const noexcept {
+        const unsigned char* p = file_.data() + i * sizeof(T);
+        using U = typename std::make_unsigned<T>::type;
+        U value = 0;
+        for (std::size_t b = 0; b < sizeof(T); b++) {
+            value = static_cast<U>(value | (static_cast<U>(p[b]) << (8 * b)));
+        }
+        T result;
+        std::memcpy(&result, &value, sizeof(T));
+        return result;
+    }
+
+    /// 提示随机访问（查找负载）
+    void adviseRandom() const noexcept { file_.advise(MappedFile::AccessPattern::Random); }
+
+    /// 提示顺序访问（扫描负载）
+    void adviseSequential() const noexcept { file_.advise(MappedFile::AccessPattern::Sequential); }
+
+    /// 提示预先加载整个文件
+    void adviseWillNeed() const noexcept { file_.advise(MappedFile::AccessPattern::WillNeed); }
+
+    /**
+     * @brief 构建内存顶层索引（Eytzinger 布局的块首键采样）
+     * @param blockBytes 数据块字节数，默认一页；会向下取整为 sizeof(T) 的倍数
+     * @note 构建需要顺序读一遍每个块的首键
+     */
+    void buildTopLevelIndex(std::size_t blockBytes = DEFAULT_BLOCK_BYTES) {
+        blockSize_ = blockBytes / sizeof(T);
+        if (blockSize_ == 0) blockSize_ = 1;
+
+        std::size_t blocks = (size_ + blockSize_ - 1) / blockSize_;
+        eytzinger_.assign(blocks + 1, T());
+        blockRank_.assign(blocks + 1, 0);
+        std::size_t next = 0;
+        fillEytzinger(1, blocks, next);
+    }
+
+    bool hasTopLevelIndex() const noexcept { return blockSize_ != 0; }
+
+    /**
+     * @brief 顶层索引占用的内存字节数
+     */
+    std::size_t topLevelIndexBytes() const noexcept {
+        return eytzinger_.capacity() * sizeof(T) + blockRank_.capacity() * sizeof(std::size_t);
+    }
+
+    /**
+     * @brief 返回第一个不小于 target 的键位置
+     * @return 位置索引，所有键都小于 target 时返回 size()
+     * @note 已构建顶层索引时只在一个数据块内二分
+     */
+    std::size_t lowerBound(T target) const {
+        if (!hasTopLevelIndex()) {
+            return lowerBoundInRange(0, size_, target);
+        }
+
+        // 在 Eytzinger 布局中查找第一个块首键 >= target 的块
+        std::size_t blocks = eytzinger_.size() - 1;
+        std::size_t i = 1;
+        while (i <= blocks) {
+            i = 2 * i + (eytzinger_[i] < target ? 1 : 0);
+        }
+        // 去掉末尾连续的 1 和其后的一个 0，得到最后一次 "向左" 的节点
+        while (i & 1) i >>= 1;
+        i >>= 1;
+        std::size_t block = (i == 0) ? blocks : blockRank_[i];
+
+        if (block == 0) return 0;
+        std::size_t begin = (block - 1) * blockSize_;
+        std::size_t end = block * blockSize_;
+        if (end > size_) end = size_;
+        return lowerBoundInRange(begin, end, target);
+    }
+
+    /**
+     * @brief 二分查找（有顶层索引时经由索引）
+     * @return 目标值首次出现的位置，未找到返回 npos
+     */
+    std::size_t binarySearch(T target) const {
+        std::size_t pos = lowerBound(target);
+        if (pos < size_ && (*this)[pos] == target) return pos;
+        return npos;
+    }
+
+    /**
+     * @brief 自适应插值查找（插值探测未能减半区间时改用二分）
+     * @return 目标值的位置，未找到返回 npos
+     * @note 适合均匀分布的键，探测次数少意味着触及的页少；最坏 O(log n)
+     */
+    std::size_t interpolationSearch(T target) const {
+        if (size_ == 0) return npos;
+
+        std::size_t low = 0;
+        std::size_t high = size_ - 1;
+        bool bisectNext = false;
+
+        while (low <= high) {
+            T lowKey = (*this)[low];
+            T highKey = (*this)[high];
+            if (target < lowKey || target > highKey) return npos;
+            if (lowKey == highKey) return lowKey == target ? low : npos;
+
+            std::size_t width = high - low;
+            std::size_t pos;
+            if (bisectNext) {
+                pos = low + width / 2;
+            } else {
+                long double ratio = (static_cast<long double>(target) - static_cast<long double>(lowKey)) /
+                                    (static_cast<long double>(highKey) - static_cast<long double>(lowKey));
+                pos = low + static_cast<std::size_t>(ratio * static_cast<long double>(width));
+                if (pos > high) pos = high;
+            }
+
+            T key = (*this)[pos];
+            if (key == target) {
+                return pos;
+            } else if (key < target) {
+                low = pos + 1;
+            } else {
+                if (pos == 0) return npos;
+                high = pos - 1;
+            }
+            if (low > high) break;
+
+            // 插值探测未能把区间缩小一半时，下一次探测改用二分
+            bisectNext = !bisectNext && (high - low) > width / 2;
+        }
+        return npos;
+    }
+
+private:
+    std::size_t lowerBoundInRange(std::size_t left, std::size_t right, T target) const {
+        while (left < right) {
+            std::size_t mid = left + (right - left) / 2;
+            if ((*this)[mid] < target) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+        return left;
+    }
+
+    // 中序遍历 Eytzinger 树，按升序填入各块首键
+    void fillEytzinger(std::size_t node, std::size_t blocks, std::size_t& next) {
+        if (node > blocks) return;
+        fillEytzinger(2 * node, blocks, next);
+        eytzinger_[node] = (*this)[next * blockSize_];
+        blockRank_[node] = next;
+        next++;
+        fillEytzinger(2 * node + 1, blocks, next);
+    }
+
+    MappedFile file_;
+    std::size_t size_;
+    std::size_t blockSize_;             ///< 每块键数，0 表示未构建顶层索引
+    std::vector<T> eytzinger_;          ///< 块首键，Eytzinger 布局（下标从1开始）
+    std::vector<std::size_t> blockRank_; ///< Eytzinger 下标 -> 块号
+};
+
+} // namespace search
+} // namespace algorithms
+
+#endif // ALGORITHMS_MAPPED_SEARCH_H
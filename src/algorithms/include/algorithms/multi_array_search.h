@@ -0,0 +1,93 @@
+#ifndef ALGORITHMS_MULTI_ARRAY_SEARCH_H
+#define ALGORITHMS_MULTI_ARRAY_SEARCH_H
+
+#include <cstddef>
+#include <vector>
+
+namespace algorithms {
+namespace search {
+
+/**
+ * @brief 多个有序数组的联合查找（分散层叠 Fractional Cascading）
+ *
+ * 对 k 个有序数组逐个二分需要 O(k log n)。分散层叠从最后一个数组开始，
+ * 把下一层增广数组中每隔一个的元素并入当前层，形成增广数组 M_i，并为
+ * M_i 的每个元素记录它在原数组 L_i 中的下界位置，以及在 M_{i+1} 中的
+ * 下界位置（桥指针）。查找时只在 M_0 上做一次二分，之后沿桥指针逐层
+ * 下降，每层最多回退一步，总代价 O(log n + k)。
+ *
+ * @note 构建时间与空间: O(N)，N 为所有数组长度之和（增广数组总长不超过 2N）
+ * @note 查找时间: O(log n + k)
+ * @note 修改第 i 个数组只需重建第 0..i 层，经常变化的数组应放在前面
+ *
+ * @example
+ * algorithms::search::MultiArraySearcher searcher({{1, 5, 9}, {2, 4, 6, 8}, {3, 7}});
+ * std::vector<std::size_t> pos = searcher.lowerBounds(5);
+ * // pos is {1, 2, 1}
+ */
+class MultiArraySearcher {
+public:
+    /**
+     * @brief 预处理 k 个已排序数组
+     * @param lists 各数组（升序，允许重复），所有权转移给查找器
+     * @throw std::invalid_argument 如果某个数组未排序
+     */
+    explicit MultiArraySearcher(std::vector<std::vector<int>> lists);
+
+    /**
+     * @brief 获取数组个数
+     */
+    std::size_t listCount() const noexcept { return lists_.size(); }
+
+    /**
+     * @brief 获取第 i 个原始数组
+     */
+    const std::vector<int>& list(std::size_t index) const { return lists_.at(index); }
+
+    /**
+     * @brief 在每个数组中查找 target 的下界位置
+     * @param target 目标值
+     * @return result[i] 为第 i 个数组中第一个不小于 target 的元素位置
+     */
+    std::vector<std::size_t> lowerBounds(int target) const;
+
+    /**
+     * @brief 在每个数组中查找 target 的下界位置（复用输出缓冲区）
+     * @param target 目标值
+     * @param result 输出，会被调整为 listCount() 个元素
+     */
+    void lowerBounds(int target, std::vector<std::size_t>& result) const;
+
+    /**
+     * @brief 替换第 index 个数组并增量重建
+     * @param index 数组下标
+     * @param list 新的已排序数组
+     * @throw std::out_of_range 如果 index 越界
+     * @throw std::invalid_argument 如果新数组未排序
+     * @note 只重建第 0..index 层
+     */
+    void updateList(std::size_t index, std::vector<int> list);
+
+    /**
+     * @brief 所有增广数组的元素总数
+     */
+    std::size_t augmentedSize() const noexcept;
+
+private:
+    /// 第 i 层增广数组；ownPos/nextPos 比 keys 多一个哨兵元素
+    struct Level {
+        std::vector<int> keys;
+        std::vector<std::size_t> ownPos;   ///< keys[p] 在 lists_[i] 中的下界位置
+        std::vector<std::size_t> nextPos;  ///< keys[p] 在下一层 keys 中的下界位置
+    };
+
+    void rebuildLevel(std::size_t index);
+
+    std::vector<std::vector<int>> lists_;
+    std::vector<Level> levels_;
+};
+
+} // namespace search
+} // namespace algorithms
+
+#endif // ALGORITHMS_MULTI_ARRAY_SEARCH_H
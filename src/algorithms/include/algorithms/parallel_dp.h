@@ -0,0 +1,56 @@
+#ifndef ALGORITHMS_PARALLEL_DP_H
+#define ALGORITHMS_PARALLEL_DP_H
+
+#include <cstddef>
+#include <string>
+
+namespace algorithms {
+
+/**
+ * @brief 每个线程至少分到的 DP 格数
+ * 
+ * 表格较小时减少线程数，避免线程创建和同步开销超过计算本身。
+ */
+constexpr std::size_t PARALLEL_DP_MIN_CELLS = std::size_t(1) << 22;
+
+/**
+ * @brief 多线程计算最长公共子序列的长度
+ * 
+ * 把位并行 LCS 的状态向量按字分成列块、把较长的字符串按行分块，分块之间
+ * 只传递列块的状态字和每行一位的加法进位。分块按反对角线波前调度：
+ * 各线程领取整行分块，等上一行的同列分块完成后再执行。
+ * 
+ * @param s1 第一个字符串
+ * @param s2 第二个字符串
+ * @param threads 线程数；0 表示使用 std::thread::hardware_concurrency()
+ * @return 最长公共子序列的长度，与 longestCommonSubsequence 相同
+ * 
+ * @note 时间复杂度: O(m * n / (64 * T))，T 为线程数（忽略流水线填充）
+ * @note 空间复杂度: O(σ * min(m, n) / 64 + max(m, n))
+ * 
+ * @example
+ * int length = algorithms::parallelLongestCommonSubsequence(genomeA, genomeB, 8);
+ */
+int parallelLongestCommonSubsequence(const std::string& s1, const std::string& s2, unsigned threads = 0);
+
+/**
+ * @brief 多线程计算编辑距离（Levenshtein 距离）
+ * 
+ * 使用 Hyyrö 分块位向量算法：较长的字符串按位排成行，每个机器字一次更新 64 行。
+ * DP 表划分为 256 行 x 2048 列的分块，分块之间只传递每列一个横向差值（-1/0/+1）
+ * 和各字的纵向位向量。分块按反对角线波前调度，方式同
+ * parallelLongestCommonSubsequence。
+ * 
+ * @param s1 第一个字符串
+ * @param s2 第二个字符串
+ * @param threads 线程数；0 表示使用 std::thread::hardware_concurrency()
+ * @return 编辑距离，与 editDistance 相同
+ * 
+ * @note 时间复杂度: O(m * n / (64 * T))，T 为线程数（忽略流水线填充）
+ * @note 空间复杂度: O(σ * max(m, n) / 64 + min(m, n))
+ */
+int parallelEditDistance(const std::string& s1, const std::string& s2, unsigned threads = 0);
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_PARALLEL_DP_H
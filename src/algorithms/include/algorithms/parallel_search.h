@@ -0,0 +1,57 @@
+#ifndef ALGORITHMS_PARALLEL_SEARCH_H
+#define ALGORITHMS_PARALLEL_SEARCH_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace algorithms {
+
+/**
+ * @brief 每个线程至少分到的文本字节数
+ * 
+ * 文本较短时减少线程数，避免线程创建开销超过扫描本身。
+ */
+constexpr std::size_t PARALLEL_SEARCH_MIN_CHUNK = 64 * 1024;
+
+/**
+ * @brief 多线程统计子串匹配数量（包括重叠匹配）
+ * 
+ * 把所有可能的起始位置平均划分给各线程，每个线程扫描自己的区间并向后多读
+ * pattern.size() - 1 个字节，因此跨越块边界的匹配只会被起点所在的线程报告一次。
+ * 每个线程使用与 forEachMatch 相同的向量化内核。
+ * 
+ * @param text 文本
+ * @param pattern 模式（为空时返回 0）
+ * @param threads 线程数；0 表示使用 std::thread::hardware_concurrency()
+ * @return 匹配数量，与 countMatches 相同
+ * 
+ * @note 时间复杂度: O(n / (w * T))，T 为线程数
+ * @note 空间复杂度: O(T)
+ * 
+ * @example
+ * std::size_t hits = algorithms::parallelCountMatches(corpus, "ERROR", 8);
+ */
+std::size_t parallelCountMatches(std::string_view text, std::string_view pattern,
+                                 unsigned threads = 0);
+
+/**
+ * @brief 多线程查找所有子串匹配
+ * 
+ * 划分方式同 parallelCountMatches。各线程把结果写入自己的缓冲区，
+ * 最后按块顺序拼接，因此结果按起始位置升序排列且没有重复。
+ * 
+ * @param text 文本
+ * @param pattern 模式（为空时返回空结果）
+ * @param threads 线程数；0 表示使用 std::thread::hardware_concurrency()
+ * @return 所有匹配起始位置（升序），与 findMatches 的结果相同
+ * 
+ * @note 时间复杂度: O(n / (w * T) + k)，k 为匹配数量
+ * @note 空间复杂度: O(k)
+ */
+std::vector<std::size_t> parallelFindAll(std::string_view text, std::string_view pattern,
+                                         unsigned threads = 0);
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_PARALLEL_SEARCH_H
@@ -0,0 +1,161 @@
+#ifndef ALGORITHMS_RABIN_KARP_H
+#define ALGORITHMS_RABIN_KARP_H
+
+#include "algorithms/aho_corasick.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+
+/**
+ * @brief Rabin-Karp 滚动哈希多模式匹配
+ * 
+ * 适合大量定长模式（例如十万个 32 字节签名）：Aho-Corasick 自动机的状态数与
+ * 模式总长成正比，而这里每个模式只占一个 64 位指纹、一个编号和模式本身。
+ * 
+ * 模式按长度分组，每种长度维护一个在文本上滑动的多项式滚动哈希（模 2^64），
+ * 每个位置先查一个按指纹散列的位图过滤器（绝大多数位置在这里被排除），
+ * 再探测紧凑的开放寻址指纹表，最后用 memcmp 校验候选，因此不会有误报。
+ * 
+ * @note 预处理时间: O(P log P)，P 为模式数；空间: 约 P * 38~48 字节 + 模式总长
+ *       （指纹 8 + 编号 4 + 偏移与长度 16 + 开放寻址表 8~16 + 位图 2~4 字节）
+ * @note 匹配时间: 期望 O(n * g + 校验)，g 为不同模式长度的个数
+ * @note 指纹不是密码学哈希，恶意构造的文本可以制造大量冲突使校验变多，但不影响正确性
+ * 
+ * @example
+ * algorithms::RabinKarpMatcher rk({"abc", "bcd", "xy"});
+ * auto matches = rk.findAll("abcdxy");
+ * // matches: {0, 0} ("abc"), {1, 1} ("bcd"), {2, 4} ("xy")
+ */
+class RabinKarpMatcher {
+public:
+    /**
+     * @brief 编译模式集合
+     * @param patterns 模式列表，patternId 即其下标；空模式永远不匹配
+     */
+    explicit RabinKarpMatcher(const std::vector<std::string>& patterns);
+
+    /**
+     * @brief 扫描文本，对每个匹配调用 visit(patternId, position)
+     * @note 按模式长度分组报告，同一长度内按起始位置升序
+     */
+    template<typename Visitor>
+    void forEachMatch(std::string_view text, Visitor&& visit) const {
+        scan(text, 0, text.size(), visit);
+    }
+
+    /**
+     * @brief 查找所有匹配
+     * @return 按起始位置、再按模式编号升序排列的匹配
+     */
+    std::vector<PatternMatch> findAll(std::string_view text) const;
+
+    /**
+     * @brief 统计匹配数量（所有可重叠匹配）
+     */
+    std::size_t count(std::string_view text) const;
+
+    /**
+     * @brief 多线程查找所有匹配
+     * 
+     * 按起始位置把文本分块，每个线程从自己的第一个起点开始滚动哈希，
+     * 并读到块末起点之后最长模式长度的位置，因此跨块的匹配只报告一次。
+     * 
+     * @param text 文本
+     * @param threads 线程数；0 表示使用 std::thread::hardware_concurrency()
+     * @return 与 findAll 相同的结果
+     */
+    std::vector<PatternMatch> findAllParallel(std::string_view text, unsigned threads = 0) const;
+
+    /**
+     * @brief 多线程统计匹配数量
+     */
+    std::size_t countParallel(std::string_view text, unsigned threads = 0) const;
+
+    std::size_t patternCount() const noexcept { return patternOffsets_.size(); }
+
+    /// 不同模式长度（滚动窗口）的个数
+    std::size_t lengthCount() const noexcept { return groups_.size(); }
+
+    /// 匹配器占用的字节数
+    std::size_t memoryBytes() const noexcept;
+
+private:
+    static constexpr std::uint64_t BASE = 0x100000001b3ULL;
+    static constexpr std::uint32_t EMPTY_SLOT = 0xffffffffu;
+
+    // 同一长度的模式
+    struct Group {
+        std::size_t length;
+        std::uint64_t power;        ///< BASE^(length-1)，用于移出窗口首字节
+        std::size_t tableOffset;    ///< 在 table_ 中的起点
+        unsigned tableBits;
+        std::size_t filterOffset;   ///< 在 filter_ 中的起点（64 位字）
+        unsigned filterBits;
+    };
+
+    static std::uint64_t mix(std::uint64_t h) noexcept {
+        h ^= h >> 29;
+        return h * 0xbf58476d1ce4e5b9ULL;
+    }
+
+    // 报告起始位置在 [begin, end) 内的匹配
+    template<typename Visitor>
+    void scan(std::string_view text, std::size_t begin, std::size_t end, Visitor& visit) const {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text.data());
+        std::size_t n = text.size();
+        for (const Group& group : groups_) {
+            std::size_t length = group.length;
+            if (n < length || begin > n - length) continue;
+            std::size_t last = std::min(end, n - length + 1);
+            if (begin >= last) continue;
+
+            std::uint64_t h = 0;
+            for (std::size_t i = 0; i < length; i++) h = h * BASE + bytes[begin + i];
+
+            const std::uint64_t* filter = filter_.data() + group.filterOffset;
+            const std::uint32_t* table = table_.data() + group.tableOffset;
+            std::size_t tableMask = (std::size_t(1) << group.tableBits) - 1;
+            for (std::size_t pos = begin;;) {
+                std::uint64_t mixed = mix(h);
+                std::uint64_t bit = mixed >> (64 - group.filterBits);
+                if ((filter[bit >> 6] >> (bit & 63)) & 1) {
+                    std::size_t slot = static_cast<std::size_t>(mixed * 0x94d049bb133111ebULL >> (64 - group.tableBits));
+                    for (; table[slot] != EMPTY_SLOT; slot = (slot + 1) & tableMask) {
+                        std::uint32_t e = table[slot];
+                        if (entryHash_[e] != h) continue;
+                        // 指纹相同的模式在 entry 数组中连续存放
+                        for (; e < entryHash_.size() && entryHash_[e] == h; e++) {
+                            std::uint32_t id = entryId_[e];
+                            if (patternOffsets_[id].second == length &&
+                                std::memcmp(bytes + pos, patternData_.data() + patternOffsets_[id].first, length) == 0) {
+                                visit(static_cast<std::size_t>(id), pos);
+                            }
+                        }
+                        break;
+                    }
+                }
+                if (++pos >= last) break;
+                h = (h - bytes[pos - 1] * group.power) * BASE + bytes[pos + length - 1];
+            }
+        }
+    }
+
+    std::vector<Group> groups_;
+    std::vector<std::uint64_t> entryHash_;   ///< 按（长度、指纹）排序的模式指纹
+    std::vector<std::uint32_t> entryId_;     ///< 与 entryHash_ 对应的模式编号
+    std::vector<std::uint32_t> table_;       ///< 开放寻址表，存放指纹在 entry 数组中的首个位置
+    std::vector<std::uint64_t> filter_;      ///< 指纹位图过滤器
+    std::string patternData_;                ///< 所有模式首尾相接
+    std::vector<std::pair<std::size_t, std::size_t>> patternOffsets_;  ///< 每个模式的（偏移, 长度）
+};
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_RABIN_KARP_H
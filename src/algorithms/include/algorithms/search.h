@@ -70,6 +70,30 @@ int linearSearch(const std::vector<int>& arr, int target);
  */
 int interpolationSearch(const std::vector<int>& arr, int target);
 
+/**
+ * @brief 自适应插值查找：插值与二分交替的混合查找，最坏情况 O(log n)
+ * 
+ * 插值探测后在目标一侧相距 sqrt(区间宽度) 处再做一次保护探测，插值准确时
+ * 区间一步收缩到 sqrt 量级。一轮插值约三次访存，因此只有区间缩小到 1/8
+ * 以内才继续插值，否则说明分布偏斜，剩余区间改用二分查找。均匀分布时保持
+ * 插值查找的 O(log log n) 表现，在 Zipf、聚簇等偏斜分布下也不会退化为
+ * 线性扫描，切换前的每轮插值都使区间缩小到 1/8 以内。
+ * 
+ * @param arr 已排序的整数向量（升序）
+ * @param target 要查找的目标值
+ * @return 目标值在数组中的索引，未找到返回-1
+ * 
+ * @note 前置条件: 数组必须已按升序排序
+ * @note 时间复杂度: 均匀分布平均 O(log log n)，最坏 O(log n)
+ * @note 空间复杂度: O(1)
+ * 
+ * @example
+ * std::vector<int> arr = {1, 2, 3, 4, 5, 1000, 1000000};
+ * int index = algorithms::search::adaptiveInterpolationSearch(arr, 1000);
+ * // index is 5
+ */
+int adaptiveInterpolationSearch(const std::vector<int>& arr, int target);
+
 /**
  * @brief 使用斐波那契查找算法在已排序数组中查找目标值
  * 
@@ -98,6 +122,7 @@ int fibonacciSearch(const std::vector<int>& arr, int target);
 using search::binarySearch;
 using search::linearSearch;
 using search::interpolationSearch;
+using search::adaptiveInterpolationSearch;
 using search::fibonacciSearch;
 
 } // namespace algorithms
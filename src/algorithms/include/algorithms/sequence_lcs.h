@@ -0,0 +1,97 @@
+#ifndef ALGORITHMS_SEQUENCE_LCS_H
+#define ALGORITHMS_SEQUENCE_LCS_H
+
+#include "algorithms/detail/token_interner.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace algorithms {
+
+/**
+ * @brief 通用序列 LCS 的求解引擎
+ */
+enum class LcsEngine {
+    Auto,          ///< 按字母表大小和匹配密度自动选择
+    BitParallel,   ///< 位并行，O(m·⌈n/64⌉)，适合小字母表、匹配稠密的序列
+    HuntSzymanski  ///< Hunt-Szymanski，O((r + m) log n)，r 为匹配对数，适合大字母表、匹配稀疏的序列
+};
+
+/**
+ * @brief 位并行引擎匹配掩码的字数上限（约 128MB）
+ * 
+ * 位并行引擎为列序列中每个不同符号保存 ⌈n/64⌉ 个字的掩码，超过该字数时
+ * Auto 改用 Hunt-Szymanski。
+ */
+constexpr std::size_t LCS_MAX_MASK_WORDS = std::size_t(1) << 24;
+
+/**
+ * @brief 为稠密编号序列选择 LCS 引擎
+ * 
+ * 估算位并行的字运算次数 max(m, n)·⌈min(m, n)/64⌉ 与 Hunt-Szymanski 的
+ * (r + m)·log2(n)，选代价较小的一个；位并行掩码超过 LCS_MAX_MASK_WORDS 时
+ * 总是选择 Hunt-Szymanski。
+ * 
+ * @param a 第一个序列（编号）
+ * @param b 第二个序列（编号）
+ * @param alphabetSize 编号范围，所有编号必须小于它
+ * @return BitParallel 或 HuntSzymanski
+ * @throw std::invalid_argument 如果存在不小于 alphabetSize 的编号
+ */
+LcsEngine selectLcsEngine(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b,
+                          std::size_t alphabetSize);
+
+/**
+ * @brief 计算两个稠密编号序列的最长公共子序列长度
+ * 
+ * @param a 第一个序列（编号）
+ * @param b 第二个序列（编号）
+ * @param alphabetSize 编号范围，所有编号必须小于它
+ * @param engine 求解引擎，默认自动选择
+ * @return 最长公共子序列的长度
+ * @throw std::invalid_argument 如果存在不小于 alphabetSize 的编号
+ * 
+ * @note 空间复杂度: BitParallel 为 O(σ·n/64 + alphabetSize)，HuntSzymanski 为 O(m + n + alphabetSize)
+ */
+std::size_t lcsLength(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b,
+                      std::size_t alphabetSize, LcsEngine engine = LcsEngine::Auto);
+
+/**
+ * @brief 任意可哈希记号序列的最长公共子序列长度
+ * 
+ * 先用 TokenInterner 把记号（行、单词、64 位编号等）驻留为稠密的 uint32 编号，
+ * 内层循环只比较整数，然后调用 lcsLength。
+ * 
+ * @param a 第一个序列的首地址
+ * @param n 第一个序列的长度
+ * @param b 第二个序列的首地址
+ * @param m 第二个序列的长度
+ * @param engine 求解引擎，默认自动选择
+ * @return 最长公共子序列的长度
+ * 
+ * @example
+ * std::vector<std::string> oldLines = {"a", "b", "c"};
+ * std::vector<std::string> newLines = {"a", "c", "d"};
+ * std::size_t common = algorithms::lcs(oldLines, newLines);
+ * // common is 2
+ */
+template<typename T, typename Hash = std::hash<T>>
+std::size_t lcs(const T* a, std::size_t n, const T* b, std::size_t m, LcsEngine engine = LcsEngine::Auto) {
+    detail::TokenInterner<T, Hash> interner;
+    std::vector<std::uint32_t> aIds = interner.internAll(a, a + n);
+    std::vector<std::uint32_t> bIds = interner.internAll(b, b + m);
+    return lcsLength(aIds, bIds, interner.size(), engine);
+}
+
+/**
+ * @brief lcs 的 vector 版本
+ */
+template<typename T, typename Hash = std::hash<T>>
+std::size_t lcs(const std::vector<T>& a, const std::vector<T>& b, LcsEngine engine = LcsEngine::Auto) {
+    return lcs<T, Hash>(a.data(), a.size(), b.data(), b.size(), engine);
+}
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_SEQUENCE_LCS_H
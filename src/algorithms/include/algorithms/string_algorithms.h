@@ -1,8 +1,17 @@
 #ifndef ALGORITHMS_STRING_ALGORITHMS_H
 #define ALGORITHMS_STRING_ALGORITHMS_H
 
-#include <vector>
+#include "algorithms/detail/cpu_features.h"
+#include "algorithms/detail/simd_search.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace algorithms {
 
@@ -54,6 +63,664 @@ std::vector<int> kmpSearch(const std::string& text, const std::string& pattern);
  */
 std::vector<int> computePrefixTable(const std::string& pattern);
 
+/**
+ * @brief 使用 Boyer-Moore-Horspool 算法查找所有模式出现位置
+ * 
+ * 每次比较窗口末尾字符，失配时按坏字符表跳过最多 m 个字符，
+ * 对较长模式和较大字母表（如英文文本）只需检查文本的一小部分。
+ * 
+ * @param text 主字符串
+ * @param pattern 模式字符串
+ * @return 所有匹配起始位置（包括重叠匹配），未找到返回空向量
+ * 
+ * @note 时间复杂度: 平均 O(n / m)，最坏 O(n * m)
+ * @note 空间复杂度: O(σ)，σ = 256
+ * 
+ * @example
+ * std::vector<int> positions = algorithms::horspoolSearch("here is a simple example", "example");
+ * // positions contains {17}
+ */
+std::vector<int> horspoolSearch(const std::string& text, const std::string& pattern);
+
+/**
+ * @brief 使用 Crochemore-Perrin Two-Way 算法查找所有模式出现位置
+ * 
+ * 将模式按临界分解切成左右两半，先从左到右比较右半部分，再从右到左比较
+ * 左半部分；对周期性模式利用周期和 "记忆" 避免重复比较。
+ * 
+ * @param text 主字符串
+ * @param pattern 模式字符串
+ * @return 所有匹配起始位置（包括重叠匹配），未找到返回空向量
+ * 
+ * @note 时间复杂度: O(n + m)（最坏情况线性）
+ * @note 空间复杂度: O(1) 额外空间
+ * @note 适合小字母表（DNA、二进制数据）和高度重复的模式
+ * 
+ * @example
+ * std::vector<int> positions = algorithms::twoWaySearch("GATTACAGATTACA", "ATTA");
+ * // positions contains {1, 8}
+ */
+std::vector<int> twoWaySearch(const std::string& text, const std::string& pattern);
+
+/**
+ * @brief 单模式查找算法
+ */
+enum class StringSearchAlgorithm {
+    Auto,      ///< 根据模式长度和字母表自动选择
+    KMP,       ///< Knuth-Morris-Pratt
+    Horspool,  ///< Boyer-Moore-Horspool
+    TwoWay     ///< Crochemore-Perrin Two-Way
+};
+
+/**
+ * @brief 根据模式特征选择查找算法
+ * 
+ * 阈值来自 benchmarks/string_search_benchmark：在英文、DNA、二进制文本上，
+ * Horspool 对所有模式长度（包括 2、3 字节）都比 KMP 和 Two-Way 快；只有模式
+ * 几乎由重复字节构成时，Horspool 的最坏情况 O(n * m) 才会出现。
+ * 
+ * - 长度不小于 4，且不同字节数不超过 2 或某个字节占 3/4 以上：Two-Way
+ * - 其他情况（包括长度小于 4 的模式，此时最坏也只是 O(3n)）：Horspool
+ * 
+ * @param pattern 模式字符串
+ * @return 推荐的算法（不会返回 Auto）
+ */
+StringSearchAlgorithm selectSearchAlgorithm(const std::string& pattern);
+
+/**
+ * @brief 使用指定（或自动选择的）算法查找所有模式出现位置
+ * 
+ * @param text 主字符串
+ * @param pattern 模式字符串
+ * @param algorithm 算法，默认 Auto 调用 selectSearchAlgorithm
+ * @return 所有匹配起始位置（包括重叠匹配），结果与 kmpSearch 相同
+ * 
+ * @example
+ * auto positions = algorithms::stringSearch("ACGTACGT", "ACGT");
+ * // positions contains {0, 4}
+ */
+std::vector<int> stringSearch(const std::string& text, const std::string& pattern,
+                              StringSearchAlgorithm algorithm = StringSearchAlgorithm::Auto);
+
+/// SIMD 指令集级别，见 detail::SimdLevel
+using SimdLevel = detail::SimdLevel;
+
+/**
+ * @brief 向量化子串查找（首尾字节过滤）
+ * 
+ * 把模式的首字节和尾字节广播到向量寄存器，一次检查 16（SSE2）、32（AVX2）
+ * 或 64（AVX-512BW）个候选起点，只有首尾字节都相等的候选才用 memcmp 校验。
+ * 运行时检测 CPU 并选择最高可用的指令集；非 x86 平台使用 memchr 标量实现。
+ * 
+ * @param text 主字符串
+ * @param pattern 模式字符串
+ * @return 所有匹配起始位置（包括重叠匹配），结果与 kmpSearch 相同
+ * 
+ * @note 时间复杂度: 平均 O(n / w)，w 为向量宽度；最坏 O(n * m)（候选全部误报时）
+ * @note 空间复杂度: O(1)（不含结果）
+ * 
+ * @example
+ * std::vector<int> positions = algorithms::simdSearch("abcabcabc", "cab");
+ * // positions contains {2, 5}
+ */
+std::vector<int> simdSearch(const std::string& text, const std::string& pattern);
+
+/**
+ * @brief 使用指定指令集级别的向量化子串查找
+ * 
+ * @param text 主字符串
+ * @param pattern 模式字符串
+ * @param level 指令集级别；超出 CPU 支持范围时自动降级
+ * @return 所有匹配起始位置（包括重叠匹配）
+ */
+std::vector<int> simdSearch(const std::string& text, const std::string& pattern, SimdLevel level);
+
+/**
+ * @brief 零拷贝子串查找：对每个匹配的起始位置调用 visit(position)
+ * 
+ * 直接在调用方的内存（string_view、mmap 区域等）上扫描，不复制文本也不分配内存。
+ * 位置使用 size_t，可以处理超过 2 GB 的文本。内部使用与 simdSearch 相同的向量化内核。
+ * 
+ * @param text 文本起始指针
+ * @param n 文本长度
+ * @param pattern 模式起始指针
+ * @param m 模式长度（为 0 时不报告任何匹配）
+ * @param visit 访问器；若返回 bool，返回 false 时提前停止扫描
+ * 
+ * @note 时间复杂度: 平均 O(n / w)，最坏 O(n * m)
+ * @note 空间复杂度: O(1)
+ * 
+ * @example
+ * std::string_view text = "abcabcabc";
+ * algorithms::forEachMatch(text, "cab", [](std::size_t pos) { std::cout << pos << ' '; });
+ * // 输出: 2 5
+ */
+template<typename Visitor>
+void forEachMatch(const char* text, std::size_t n, const char* pattern, std::size_t m,
+                  Visitor&& visit) {
+    auto onMatch = [&visit](std::size_t pos) {
+        if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, std::size_t>, bool>) {
+            return visit(pos);
+        } else {
+            visit(pos);
+            return true;
+        }
+    };
+    detail::simdScan(text, n, pattern, m, detail::detectSimdLevel(), onMatch);
+}
+
+/**
+ * @brief forEachMatch 的 string_view 版本
+ */
+template<typename Visitor>
+void forEachMatch(std::string_view text, std::string_view pattern, Visitor&& visit) {
+    forEachMatch(text.data(), text.size(), pattern.data(), pattern.size(),
+                 std::forward<Visitor>(visit));
+}
+
+/**
+ * @brief 把所有匹配的起始位置（size_t）写入输出迭代器
+ * 
+ * @param text 文本
+ * @param pattern 模式
+ * @param out 输出迭代器，例如 std::back_inserter(vec) 或预先分配好的缓冲区指针
+ * @return 写入最后一个位置之后的迭代器
+ */
+template<typename OutputIt>
+OutputIt findMatches(std::string_view text, std::string_view pattern, OutputIt out) {
+    forEachMatch(text, pattern, [&out](std::size_t pos) { *out++ = pos; });
+    return out;
+}
+
+/**
+ * @brief 统计匹配数量（包括重叠匹配），不分配内存
+ */
+std::size_t countMatches(const char* text, std::size_t n, const char* pattern, std::size_t m) noexcept;
+
+/**
+ * @brief countMatches 的 string_view 版本
+ */
+inline std::size_t countMatches(std::string_view text, std::string_view pattern) noexcept {
+    return countMatches(text.data(), text.size(), pattern.data(), pattern.size());
+}
+
+/**
+ * @brief 查找第一个匹配，找到后立即停止扫描，不分配内存
+ * @return 第一个匹配的起始位置，未找到（或模式为空）返回 std::string_view::npos
+ */
+std::size_t findFirstMatch(const char* text, std::size_t n, const char* pattern, std::size_t m) noexcept;
+
+/**
+ * @brief findFirstMatch 的 string_view 版本
+ */
+inline std::size_t findFirstMatch(std::string_view text, std::string_view pattern) noexcept {
+    return findFirstMatch(text.data(), text.size(), pattern.data(), pattern.size());
+}
+
+/**
+ * @brief Two-Way 匹配器（预计算临界分解，不持有模式）
+ * 
+ * 构造时计算模式的临界分解位置和周期，之后可以对多段文本查找。
+ * 只保存模式的 string_view，模式在匹配器生命周期内必须保持有效。
+ * 
+ * @note 预处理时间复杂度: O(m)，空间复杂度: O(1)
+ */
+class TwoWaySearcher {
+public:
+    explicit TwoWaySearcher(std::string_view pattern);
+
+    std::string_view pattern() const noexcept { return pattern_; }
+
+    /**
+     * @brief 扫描文本，对每个匹配调用 onMatch(position)
+     * @param text 文本起始指针
+     * @param n 文本长度
+     * @param onMatch 回调，返回 false 时停止扫描
+     * @note 报告所有（可重叠的）匹配，不分配内存
+     */
+    template<typename OnMatch>
+    void scan(const char* text, std::size_t n, OnMatch&& onMatch) const {
+        const char* x = pattern_.data();
+        std::size_t m = pattern_.size();
+        if (m == 0 || n < m) return;
+
+        std::size_t pos = 0;
+        std::size_t memory = 0;
+        const char* y = text;
+        while (pos <= n - m) {
+            // 从临界位置开始从左到右比较右半部分
+            std::size_t k = critical_ > memory ? critical_ : memory;
+            while (k < m && x[k] == y[pos + k]) k++;
+            if (k < m) {
+                pos += k - critical_ + 1;
+                memory = 0;
+                continue;
+            }
+
+            // 从右到左比较左半部分（周期模式下前 memory 个字符已知匹配）
+            k = critical_;
+            while (k > memory && x[k - 1] == y[pos + k - 1]) k--;
+            if (k <= memory) {
+                if (!onMatch(pos)) return;
+            }
+            pos += period_;
+            memory = periodic_ ? m - period_ : 0;
+        }
+    }
+
+private:
+    std::string_view pattern_;
+    std::size_t critical_;  ///< 临界分解位置，左半部分为 [0, critical_)
+    std::size_t period_;    ///< 完整匹配后的安全移动距离
+    bool periodic_;         ///< 模式是否为周期性的（需要记忆）
+};
+
+/**
+ * @brief 预编译的单模式匹配器
+ * 
+ * 构造时一次性计算 KMP 失败表和 Horspool 坏字符跳转表，之后可以对任意多段
+ * 文本重复查找，避免 kmpSearch 每次调用都重新计算前缀表并分配内存。
+ * 长度不小于 HORSPOOL_MIN_LENGTH 的模式使用 Horspool 跳跃扫描（平均跳过
+ * 大部分文本字符），更短的模式使用 KMP。
+ * 
+ * 所有查找方法都是 const 且不修改任何内部状态，可在多个线程中并发使用同一对象。
+ * findFirst、count 和 forEach 不分配内存；findAll 的缓冲区版本只在容量不足时扩容。
+ * 
+ * @note 预处理时间复杂度: O(m + σ)
+ * @note 查找时间复杂度: KMP 为 O(n)；Horspool 平均 O(n / m)，最坏 O(n * m)
+ * @note 空间复杂度: O(m + σ)
+ * @note 报告所有（可重叠的）匹配，结果与 kmpSearch 相同
+ * 
+ * @example
+ * algorithms::CompiledPattern pattern("needle");
+ * std::size_t first = pattern.findFirst("haystack with needle");  // 14
+ * std::size_t total = pattern.count("needle needle");              // 2
+ */
+class CompiledPattern {
+public:
+    static constexpr std::size_t npos = std::string_view::npos;
+
+    /// 使用 Horspool 的最小模式长度
+    static constexpr std::size_t HORSPOOL_MIN_LENGTH = 4;
+
+    /**
+     * @brief 编译模式
+     * @param pattern 模式字符串（空模式永远不匹配）
+     */
+    explicit CompiledPattern(std::string pattern);
+
+    const std::string& pattern() const noexcept { return pattern_; }
+
+    /**
+     * @brief 查找第一个匹配
+     * @return 第一个匹配的起始位置，未找到返回 npos
+     */
+    std::size_t findFirst(std::string_view text) const;
+
+    /**
+     * @brief 统计匹配数量（包括重叠匹配）
+     */
+    std::size_t count(std::string_view text) const;
+
+    /**
+     * @brief 查找所有匹配
+     * @return 所有匹配起始位置（升序）
+     */
+    std::vector<std::size_t> findAll(std::string_view text) const;
+
+    /**
+     * @brief 查找所有匹配，写入调用者提供的缓冲区
+     * @param text 文本
+     * @param positions 输出缓冲区，先被清空；复用同一缓冲区可避免重复分配
+     */
+    void findAll(std::string_view text, std::vector<std::size_t>& positions) const;
+
+    /**
+     * @brief 对每个匹配的起始位置调用 visit(position)
+     */
+    template<typename Visitor>
+    void forEach(std::string_view text, Visitor&& visit) const {
+        scan(text, [&visit](std::size_t pos) {
+            visit(pos);
+            return true;
+        });
+    }
+
+private:
+    // onMatch(pos) 返回 false 时停止扫描
+    template<typename OnMatch>
+    void scan(std::string_view text, OnMatch&& onMatch) const {
+        std::size_t n = text.size();
+        std::size_t m = pattern_.size();
+        if (m == 0 || n < m) return;
+
+        if (m >= HORSPOOL_MIN_LENGTH) {
+            const char* p = pattern_.data();
+            unsigned char last = static_cast<unsigned char>(p[m - 1]);
+            std::size_t i = 0;
+            while (i <= n - m) {
+                unsigned char c = static_cast<unsigned char>(text[i + m - 1]);
+                if (c == last && std::memcmp(text.data() + i, p, m - 1) == 0) {
+                    if (!onMatch(i)) return;
+                }
+                i += skip_[c];
+            }
+            return;
+        }
+
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            while (j > 0 && pattern_[j] != text[i]) {
+                j = static_cast<std::size_t>(prefixTable_[j - 1]);
+            }
+            if (pattern_[j] == text[i]) j++;
+            if (j == m) {
+                if (!onMatch(i + 1 - m)) return;
+                j = static_cast<std::size_t>(prefixTable_[j - 1]);
+            }
+        }
+    }
+
+    std::string pattern_;
+    std::vector<int> prefixTable_;  ///< KMP 失败表
+    std::size_t skip_[256];         ///< Horspool 坏字符跳转表
+};
+
+/**
+ * @brief 跨缓冲区边界保持状态的流式匹配器
+ * 
+ * 按块调用 feed() 输入文本，匹配器在调用之间保存 KMP 状态（已匹配的模式前缀长度），
+ * 因此横跨两个块边界的匹配也不会遗漏。每个匹配通过回调报告其在整个流中的
+ * 64 位绝对起始偏移。使用固定大小的读缓冲区即可以常数内存扫描任意大的文件。
+ * 
+ * @note 时间复杂度: 每个输入字节摊还 O(1)
+ * @note 空间复杂度: O(m)，与已输入的数据量无关
+ * 
+ * @example
+ * std::vector<std::uint64_t> offsets;
+ * algorithms::StreamingMatcher matcher("needle", [&](std::uint64_t pos) { offsets.push_back(pos); });
+ * matcher.feed("hay nee", 7);
+ * matcher.feed("dle hay", 7);
+ * // offsets contains {4}
+ */
+class StreamingMatcher {
+public:
+    /// 匹配回调，参数为匹配在整个流中的起始偏移
+    using Callback = std::function<void(std::uint64_t)>;
+
+    /**
+     * @brief 构造流式匹配器
+     * @param pattern 模式字符串（空模式永远不匹配）
+     * @param onMatch 匹配回调
+     */
+    StreamingMatcher(std::string pattern, Callback onMatch);
+
+    /**
+     * @brief 输入下一块数据
+     * @param data 数据起始指针
+     * @param size 数据长度
+     */
+    void feed(const char* data, std::size_t size);
+
+    /**
+     * @brief 输入下一块数据
+     */
+    void feed(std::string_view chunk) { feed(chunk.data(), chunk.size()); }
+
+    /**
+     * @brief 重置为流的起点（清除部分匹配状态和偏移计数）
+     */
+    void reset() noexcept;
+
+    const std::string& pattern() const noexcept { return pattern_; }
+
+    /// 已输入的总字节数
+    std::uint64_t bytesConsumed() const noexcept { return offset_; }
+
+    /// 已报告的匹配数量
+    std::uint64_t matchCount() const noexcept { return matches_; }
+
+private:
+    std::string pattern_;
+    std::vector<int> prefixTable_;
+    Callback onMatch_;
+    std::size_t state_;      ///< 当前已匹配的模式前缀长度
+    std::uint64_t offset_;   ///< 下一个输入字节的绝对偏移
+    std::uint64_t matches_;
+};
+
+/**
+ * @brief 近似匹配的一次命中
+ */
+struct ApproximateMatch {
+    std::size_t position;  ///< ShiftOrMatcher 为起始位置，MyersMatcher 为结束位置（最后一个字符）
+    std::size_t errors;    ///< 错误数（不匹配字符数或编辑距离）
+
+    bool operator==(const ApproximateMatch& other) const {
+        return position == other.position && errors == other.errors;
+    }
+};
+
+/**
+ * @brief k 不匹配（Hamming 距离）近似匹配器（Wu-Manber Shift-Or）
+ * 
+ * 为每个错误数 d = 0..k 维护一个状态位向量 R_d，第 j 位为 0 表示模式前 j+1 个
+ * 字符与当前位置结尾的文本最多有 d 处不同。每个文本字符的更新只需移位和按位运算：
+ *   R_0' = (R_0 << 1) | B[c]
+ *   R_d' = ((R_d << 1) | B[c]) & (R_{d-1} << 1)
+ * 模式不超过 64 个字符时每个状态占一个机器字，更长的模式按 64 位分块。
+ * 
+ * feed() 在调用之间保留状态，可以按块扫描任意长的流；visit(start, mismatches)
+ * 收到的是匹配在整个流中的 64 位起始偏移和最少不匹配数。
+ * 
+ * @note 时间复杂度: O(n * (k + 1) * ⌈m / 64⌉)
+ * @note 空间复杂度: O((σ + k) * ⌈m / 64⌉)
+ * 
+ * @example
+ * algorithms::ShiftOrMatcher matcher("hello", 1);
+ * matcher.feed("jello help hello", 16, [](std::uint64_t start, std::size_t errors) {
+ *     // (0, 1), (11, 0)
+ * });
+ */
+class ShiftOrMatcher {
+public:
+    /**
+     * @brief 构造匹配器
+     * @param pattern 模式（空模式永远不匹配）
+     * @param maxMismatches 允许的最多不匹配字符数 k
+     */
+    ShiftOrMatcher(std::string pattern, std::size_t maxMismatches);
+
+    const std::string& pattern() const noexcept { return pattern_; }
+    std::size_t maxErrors() const noexcept { return k_; }
+
+    /**
+     * @brief 输入下一块数据，对每个近似匹配调用 visit(start, mismatches)
+     */
+    template<typename Visitor>
+    void feed(const char* data, std::size_t size, Visitor&& visit) {
+        std::size_t m = pattern_.size();
+        if (m == 0) {
+            offset_ += size;
+            return;
+        }
+
+        const std::size_t words = words_;
+        const std::size_t top = (m - 1) / 64;
+        const std::uint64_t topBit = std::uint64_t(1) << ((m - 1) % 64);
+        for (std::size_t i = 0; i < size; i++) {
+            const std::uint64_t* mask = &mask_[static_cast<unsigned char>(data[i]) * words];
+            // 从高错误层到低错误层更新，保证 R_{d-1} 仍是旧值；每层从高位字到低位字移位
+            for (std::size_t d = k_ + 1; d-- > 0;) {
+                std::uint64_t* r = &state_[d * words];
+                const std::uint64_t* lower = d > 0 ? &state_[(d - 1) * words] : nullptr;
+                for (std::size_t w = words; w-- > 0;) {
+                    std::uint64_t carry = w > 0 ? r[w - 1] >> 63 : 0;
+                    std::uint64_t shifted = (r[w] << 1) | carry;
+                    std::uint64_t next = shifted | mask[w];
+                    if (lower != nullptr) {
+                        std::uint64_t lowerCarry = w > 0 ? lower[w - 1] >> 63 : 0;
+                        next &= (lower[w] << 1) | lowerCarry;
+                    }
+                    r[w] = next;
+                }
+            }
+            for (std::size_t d = 0; d <= k_; d++) {
+                if ((state_[d * words + top] & topBit) == 0) {
+                    visit(offset_ + i + 1 - m, d);
+                    break;
+                }
+            }
+        }
+        offset_ += size;
+    }
+
+    /**
+     * @brief 重置为流的起点
+     */
+    void reset() noexcept;
+
+    /// 已输入的总字节数
+    std::uint64_t bytesConsumed() const noexcept { return offset_; }
+
+private:
+    std::string pattern_;
+    std::size_t k_;
+    std::size_t words_;
+    std::vector<std::uint64_t> mask_;   ///< B[c]：第 j 位为 0 当且仅当 pattern[j] == c
+    std::vector<std::uint64_t> state_;  ///< (k + 1) 个状态向量，每个 words_ 个字
+    std::uint64_t offset_;
+};
+
+/**
+ * @brief k 编辑距离近似匹配器（Myers 位向量算法）
+ * 
+ * 用位向量表示动态规划矩阵一列中相邻行的差值（+1/-1/0），每个文本字符
+ * 只需常数次字运算即可算出整列，并维护模式末行的值，即以当前位置结尾的
+ * 文本子串与模式的最小编辑距离。模式不超过 64 个字符时只用一个机器字，
+ * 更长的模式分成 64 行一块，块之间传递水平差值（Hyyrö 分块）。
+ * 
+ * 编辑距离匹配的起点不唯一，因此 visit(end, distance) 收到的是匹配在整个流中的
+ * 结束位置（最后一个字符的 64 位偏移）以及在该位置结尾的最小编辑距离。
+ * 
+ * @note 时间复杂度: O(n * ⌈m / 64⌉)
+ * @note 空间复杂度: O(σ * ⌈m / 64⌉)
+ * 
+ * @example
+ * algorithms::MyersMatcher matcher("survey", 2);
+ * matcher.feed("surgery", 7, [](std::uint64_t end, std::size_t distance) {
+ *     // (4, 2), (5, 2), (6, 2)
+ * });
+ */
+class MyersMatcher {
+public:
+    /**
+     * @brief 构造匹配器
+     * @param pattern 模式（空模式永远不匹配）
+     * @param maxDistance 允许的最大编辑距离 k
+     */
+    MyersMatcher(std::string pattern, std::size_t maxDistance);
+
+    const std::string& pattern() const noexcept { return pattern_; }
+    std::size_t maxErrors() const noexcept { return k_; }
+
+    /**
+     * @brief 输入下一块数据，对每个满足距离上限的结束位置调用 visit(end, distance)
+     */
+    template<typename Visitor>
+    void feed(const char* data, std::size_t size, Visitor&& visit) {
+        std::size_t m = pattern_.size();
+        if (m == 0) {
+            offset_ += size;
+            return;
+        }
+
+        const std::size_t words = words_;
+        const std::uint64_t lastHigh = std::uint64_t(1) << ((m - 1) % 64);
+        for (std::size_t i = 0; i < size; i++) {
+            const std::uint64_t* eq = &peq_[static_cast<unsigned char>(data[i]) * words];
+            // 第 0 行（空模式前缀）恒为 0，因此进入第一块的水平差值为 0
+            int carry = 0;
+            for (std::size_t w = 0; w + 1 < words; w++) {
+                carry = advanceBlock(pv_[w], mv_[w], eq[w], carry, std::uint64_t(1) << 63);
+            }
+            score_ += advanceBlock(pv_[words - 1], mv_[words - 1], eq[words - 1], carry, lastHigh);
+            if (static_cast<std::size_t>(score_) <= k_) {
+                visit(offset_ + i, static_cast<std::size_t>(score_));
+            }
+        }
+        offset_ += size;
+    }
+
+    /**
+     * @brief 重置为流的起点
+     */
+    void reset() noexcept;
+
+    /// 已输入的总字节数
+    std::uint64_t bytesConsumed() const noexcept { return offset_; }
+
+private:
+    // 计算一块 64 行的新一列，返回 high 所在行的水平差值
+    static int advanceBlock(std::uint64_t& pv, std::uint64_t& mv, std::uint64_t eq,
+                            int carryIn, std::uint64_t high) noexcept {
+        std::uint64_t xv = eq | mv;
+        if (carryIn < 0) eq |= 1;
+        std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        std::uint64_t ph = mv | ~(xh | pv);
+        std::uint64_t mh = pv & xh;
+
+        int carryOut = 0;
+        if (ph & high) {
+            carryOut = 1;
+        } else if (mh & high) {
+            carryOut = -1;
+        }
+
+        ph <<= 1;
+        mh <<= 1;
+        if (carryIn < 0) {
+            mh |= 1;
+        } else if (carryIn > 0) {
+            ph |= 1;
+        }
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+        return carryOut;
+    }
+
+    std::string pattern_;
+    std::size_t k_;
+    std::size_t words_;
+    std::vector<std::uint64_t> peq_;  ///< Peq[c]：第 j 位为 1 当且仅当 pattern[j] == c
+    std::vector<std::uint64_t> pv_;   ///< 垂直差值为 +1 的行
+    std::vector<std::uint64_t> mv_;   ///< 垂直差值为 -1 的行
+    long long score_;                 ///< 末行的值
+    std::uint64_t offset_;
+};
+
+/**
+ * @brief 查找所有最多 k 处不匹配的出现位置
+ * @return 按起始位置升序排列的匹配，errors 为不匹配字符数
+ * 
+ * @example
+ * auto matches = algorithms::findMismatchMatches("jello help hello", "hello", 1);
+ * // matches contains {{0, 1}, {11, 0}}
+ */
+std::vector<ApproximateMatch> findMismatchMatches(std::string_view text, std::string_view pattern,
+                                                  std::size_t maxMismatches);
+
+/**
+ * @brief 查找所有与模式编辑距离不超过 k 的子串结束位置
+ * @return 按结束位置升序排列的匹配，errors 为在该位置结尾的最小编辑距离
+ * 
+ * @example
+ * auto matches = algorithms::findEditMatches("surgery", "survey", 2);
+ * // matches contains {{4, 2}, {5, 2}, {6, 2}}
+ */
+std::vector<ApproximateMatch> findEditMatches(std::string_view text, std::string_view pattern,
+                                              std::size_t maxDistance);
+
 } // namespace algorithms
 
-#endif // ALGORITHMS_STRING_ALGORITHMS_H
\ No newline at end of file
+#endif // ALGORITHMS_STRING_ALGORITHMS_H
@@ -0,0 +1,126 @@
+#ifndef ALGORITHMS_SUFFIX_ARRAY_H
+#define ALGORITHMS_SUFFIX_ARRAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace algorithms {
+
+/**
+ * @brief 后缀数组索引（SA-IS 构建 + Kasai LCP）
+ * 
+ * 对同一段静态文本反复查询大量不同模式时，每次 kmpSearch 都要 O(n + m)。
+ * 后缀数组把文本的所有后缀按字典序排好，任意模式的出现位置在后缀数组中
+ * 都是一段连续区间，用二分查找即可定位，与文本长度几乎无关。
+ * 
+ * 构建使用 SA-IS（诱导排序）算法，时间 O(n)；LCP 数组用 Kasai 算法 O(n) 求出。
+ * 查询时二分查找维护模式与左右边界后缀的最长公共前缀 l、r，每次比较从
+ * min(l, r) 处开始，跳过已知相同的前缀。
+ * 
+ * 下标使用 uint32_t 存储，索引大小约为 9n 字节（文本 + SA + LCP）。
+ * 
+ * @note 构建时间复杂度: O(n)，空间复杂度: O(n)
+ * @note 查询时间复杂度: O(m log n)，实际比较次数通常接近 O(m + log n)
+ * 
+ * @example
+ * algorithms::SuffixArray index("banana");
+ * index.count("ana");                 // 2
+ * index.locate("ana");                // {1, 3}
+ * index.longestRepeatedSubstring();   // "ana"
+ */
+class SuffixArray {
+public:
+    /// 支持的最大文本长度
+    static constexpr std::size_t MAX_TEXT_LENGTH = 0x7fffffffu;
+
+    /**
+     * @brief 为文本建立后缀数组和 LCP 数组
+     * @param text 文本（所有权转移给索引）
+     * @throw std::length_error 如果文本长度超过 MAX_TEXT_LENGTH
+     */
+    explicit SuffixArray(std::string text);
+
+    /**
+     * @brief 获取被索引的文本
+     */
+    const std::string& text() const noexcept { return text_; }
+
+    /**
+     * @brief 获取文本长度
+     */
+    std::size_t size() const noexcept { return text_.size(); }
+
+    /**
+     * @brief 获取后缀数组：suffixes()[i] 为字典序第 i 小的后缀的起始位置
+     */
+    const std::vector<std::uint32_t>& suffixes() const noexcept { return sa_; }
+
+    /**
+     * @brief 获取 LCP 数组：lcp()[i] 为第 i 个与第 i-1 个后缀的最长公共前缀长度，lcp()[0] = 0
+     */
+    const std::vector<std::uint32_t>& lcp() const noexcept { return lcp_; }
+
+    /**
+     * @brief 查找以 pattern 为前缀的后缀在后缀数组中的区间
+     * @param pattern 模式
+     * @return 半开区间 [first, second)；模式为空或不出现时区间为空
+     */
+    std::pair<std::size_t, std::size_t> range(std::string_view pattern) const;
+
+    /**
+     * @brief 统计模式在文本中的出现次数（包括重叠出现）
+     */
+    std::size_t count(std::string_view pattern) const;
+
+    /**
+     * @brief 判断模式是否在文本中出现
+     */
+    bool contains(std::string_view pattern) const { return count(pattern) > 0; }
+
+    /**
+     * @brief 查找模式的所有出现位置
+     * @return 升序排列的起始位置，与 kmpSearch 的结果相同
+     */
+    std::vector<std::size_t> locate(std::string_view pattern) const;
+
+    /**
+     * @brief 查找最长的重复子串（至少出现两次，允许重叠）
+     * @return 指向 text() 内部的视图；不存在重复子串时返回空视图
+     */
+    std::string_view longestRepeatedSubstring() const;
+
+    /**
+     * @brief 把索引（文本、SA、LCP）保存到二进制文件
+     * @throw std::runtime_error 如果文件无法写入
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief 从 save() 生成的文件加载索引，无需重新构建
+     * @throw std::runtime_error 如果文件无法读取或格式不正确
+     */
+    static SuffixArray load(const std::string& path);
+
+    /**
+     * @brief 获取索引占用的内存大小（字节）
+     */
+    std::size_t memoryBytes() const noexcept;
+
+private:
+    SuffixArray() = default;
+
+    // 返回第一个不满足 "后缀 < pattern"（upper 为 true 时为 "后缀 <= pattern 前缀"）的位置
+    std::size_t bound(std::string_view pattern, bool upper) const;
+
+    std::string text_;
+    std::vector<std::uint32_t> sa_;
+    std::vector<std::uint32_t> lcp_;
+};
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_SUFFIX_ARRAY_H
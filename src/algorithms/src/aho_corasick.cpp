@@ -0,0 +1,151 @@
+#include "algorithms/aho_corasick.h"
+#include <algorithm>
+
+namespace algorithms {
+
+AhoCorasick::AhoCorasick(const std::vector<std::string>& patterns)
+    : stride_(1), byteClass_(), delta_(), firstOutput_(), outputLink_(),
+      outputStart_(), outputs_(), patternLengths_(), maxPatternLength_(0) {
+    // 字节压缩：模式中出现的字节依次编号为 1..σ，其余字节归入第 0 列
+    for (const auto& pattern : patterns) {
+        for (char ch : pattern) {
+            unsigned char c = static_cast<unsigned char>(ch);
+            if (byteClass_[c] == 0) {
+                byteClass_[c] = static_cast<std::uint16_t>(stride_++);
+            }
+        }
+    }
+
+    // 建 trie：未定义的转移暂记为 NO_STATE
+    delta_.assign(stride_, NO_STATE);
+    std::vector<std::vector<std::int32_t>> ownOutputs(1);
+    patternLengths_.reserve(patterns.size());
+
+    for (std::size_t id = 0; id < patterns.size(); id++) {
+        const std::string& pattern = patterns[id];
+        patternLengths_.push_back(pattern.size());
+        if (pattern.empty()) continue;
+        maxPatternLength_ = std::max(maxPatternLength_, pattern.size());
+
+        std::int32_t state = 0;
+        for (char ch : pattern) {
+            std::size_t slot = static_cast<std::size_t>(state) * stride_ +
+                               byteClass_[static_cast<unsigned char>(ch)];
+            if (delta_[slot] == NO_STATE) {
+                std::int32_t created = static_cast<std::int32_t>(ownOutputs.size());
+                delta_[slot] = created;
+                delta_.resize(delta_.size() + stride_, NO_STATE);
+                ownOutputs.emplace_back();
+            }
+            state = delta_[slot];
+        }
+        ownOutputs[state].push_back(static_cast<std::int32_t>(id));
+    }
+
+    std::size_t states = ownOutputs.size();
+    std::vector<std::int32_t> fail(states, 0);
+    outputLink_.assign(states, NO_STATE);
+    firstOutput_.assign(states, NO_STATE);
+    if (!ownOutputs[0].empty()) firstOutput_[0] = 0;
+
+    // BFS 计算失败链接，同时把缺失转移补全为 DFA 转移
+    std::vector<std::int32_t> queue;
+    queue.reserve(states);
+    for (std::size_t c = 0; c < stride_; c++) {
+        std::int32_t& next = delta_[c];
+        if (next == NO_STATE) {
+            next = 0;
+        } else {
+            fail[next] = 0;
+            queue.push_back(next);
+        }
+    }
+
+    for (std::size_t head = 0; head < queue.size(); head++) {
+        std::int32_t state = queue[head];
+        std::int32_t f = fail[state];
+        outputLink_[state] = firstOutput_[f];
+        firstOutput_[state] = ownOutputs[state].empty() ? outputLink_[state] : state;
+
+        std::size_t row = static_cast<std::size_t>(state) * stride_;
+        std::size_t failRow = static_cast<std::size_t>(f) * stride_;
+        for (std::size_t c = 0; c < stride_; c++) {
+            std::int32_t next = delta_[row + c];
+            if (next == NO_STATE) {
+                delta_[row + c] = delta_[failRow + c];
+            } else {
+                fail[next] = delta_[failRow + c];
+                queue.push_back(next);
+            }
+        }
+    }
+
+    // 输出表压缩为 CSR
+    outputStart_.assign(states + 1, 0);
+    for (std::size_t s = 0; s < states; s++) {
+        outputStart_[s + 1] = outputStart_[s] + static_cast<std::int32_t>(ownOutputs[s].size());
+    }
+    outputs_.reserve(static_cast<std::size_t>(outputStart_[states]));
+    for (const auto& own : ownOutputs) {
+        outputs_.insert(outputs_.end(), own.begin(), own.end());
+    }
+}
+
+std::vector<PatternMatch> AhoCorasick::findAll(std::string_view text, MatchKind kind) const {
+    std::vector<PatternMatch> matches;
+    if (kind == MatchKind::All) {
+        forEachMatch(text, [&matches](std::size_t id, std::size_t pos) {
+            matches.push_back({id, pos});
+        });
+        return matches;
+    }
+    if (maxPatternLength_ == 0) return matches;
+
+    // 最左最长：longest[s % L] 记录起点 s 上最长的模式（L 为最长模式长度）。
+    // 扫描到结束位置 e 之后，起点 e - L 不会再有新的匹配，此时确定它是否被选取
+    const std::size_t window = maxPatternLength_;
+    std::vector<std::int32_t> longest(window, NO_STATE);
+    std::size_t nextFree = 0;
+    auto settle = [&](std::size_t start) {
+        std::int32_t& slot = longest[start % window];
+        if (slot != NO_STATE && start >= nextFree) {
+            std::size_t id = static_cast<std::size_t>(slot);
+            matches.push_back({id, start});
+            nextFree = start + patternLengths_[id];
+        }
+        slot = NO_STATE;
+    };
+
+    std::int32_t state = 0;
+    for (std::size_t i = 0; i < text.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        state = delta_[static_cast<std::size_t>(state) * stride_ + byteClass_[c]];
+        for (std::int32_t s = firstOutput_[state]; s != NO_STATE; s = outputLink_[s]) {
+            // 同一状态的模式相同，取编号最小者；同一起点后结束的匹配更长，直接覆盖
+            std::size_t id = static_cast<std::size_t>(outputs_[outputStart_[s]]);
+            longest[(i + 1 - patternLengths_[id]) % window] = static_cast<std::int32_t>(id);
+        }
+        if (i + 1 >= window) settle(i + 1 - window);
+    }
+    std::size_t tail = text.size() >= window ? text.size() - window + 1 : 0;
+    for (std::size_t start = tail; start < text.size(); start++) settle(start);
+    return matches;
+}
+
+std::size_t AhoCorasick::count(std::string_view text) const {
+    std::size_t total = 0;
+    forEachMatch(text, [&total](std::size_t, std::size_t) { total++; });
+    return total;
+}
+
+std::size_t AhoCorasick::memoryBytes() const noexcept {
+    return sizeof(*this) +
+           delta_.capacity() * sizeof(std::int32_t) +
+           firstOutput_.capacity() * sizeof(std::int32_t) +
+           outputLink_.capacity() * sizeof(std::int32_t) +
+           outputStart_.capacity() * sizeof(std::int32_t) +
+           outputs_.capacity() * sizeof(std::int32_t) +
+           patternLengths_.capacity() * sizeof(std::size_t);
+}
+
+} // namespace algorithms
@@ -0,0 +1,200 @@
+#include "algorithms/detail/bit_parallel_lcs.h"
+#include "algorithms/detail/bit_ops.h"
+#include <algorithm>
+
+#if ALGORITHMS_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace algorithms {
+namespace detail {
+
+namespace {
+
+inline std::size_t symbolIndex(char c) noexcept { return static_cast<unsigned char>(c); }
+inline std::size_t symbolIndex(std::uint32_t id) noexcept { return id; }
+
+// 一个字的加法进位更新：V = (V + (V & M)) | (V & ~M)
+inline std::uint64_t step(std::uint64_t x, std::uint64_t mask, std::uint64_t& carry) noexcept {
+    std::uint64_t u = x & mask;
+    std::uint64_t sum = x + u;
+    std::uint64_t carryOut = sum < x ? 1 : 0;
+    sum += carry;
+    carryOut |= sum < carry ? 1 : 0;
+    carry = carryOut;
+    return sum | (x & ~mask);
+}
+
+// 每次处理的行数：行块内按字组从低到高推进，组间的进位逐行暂存在栈上
+constexpr std::size_t ROW_CHUNK = 256;
+
+// 不值得斜排的规模：字数或行数太少时 3 步的填充开销占比过大
+constexpr std::size_t AVX2_MIN_WORDS = 8;
+constexpr std::size_t AVX2_MIN_ROWS = 16;
+
+#if ALGORITHMS_ARCH_X86 && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && \
+    (defined(__x86_64__) || defined(_M_X64))
+#define ALGORITHMS_HAS_LCS_AVX2 1
+
+// 斜排 AVX2：rowMasks[3 + r] 为行块第 r 行的掩码（nullptr 表示全 0），
+// 前后各留 3 个 nullptr，使未开始或已结束的通道读到全 0 掩码、不改变状态
+ALGORITHMS_TARGET_AVX2
+void advanceGroupsAvx2(std::uint64_t* v, std::size_t groups, const std::uint64_t* const* rowMasks,
+                       std::size_t count, std::uint8_t* carries) noexcept {
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i allOnes = _mm256_set1_epi64x(-1);
+    const __m256i one = _mm256_set1_epi64x(1);
+
+    for (std::size_t g = 0; g < groups; g++) {
+        std::size_t w0 = g * 4;
+        __m256i state = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + w0));
+        __m256i carryIn = _mm256_setzero_si256();
+
+        // 第 s 步：通道 k 处理第 s - k 行的第 w0 + k 个字
+        for (std::size_t s = 0; s < count + 3; s++) {
+            const std::uint64_t* const* row = rowMasks + s + 3;
+            std::uint64_t m0 = row[0] != nullptr ? row[0][w0] : 0;
+            std::uint64_t m1 = row[-1] != nullptr ? row[-1][w0 + 1] : 0;
+            std::uint64_t m2 = row[-2] != nullptr ? row[-2][w0 + 2] : 0;
+            std::uint64_t m3 = row[-3] != nullptr ? row[-3][w0 + 3] : 0;
+            __m256i mask = _mm256_set_epi64x(static_cast<long long>(m3), static_cast<long long>(m2),
+                                             static_cast<long long>(m1), static_cast<long long>(m0));
+
+            // 通道 0 的进位来自上一组字的同一行
+            long long lowCarry = s < count ? carries[s] : 0;
+            carryIn = _mm256_blend_epi32(carryIn, _mm256_set1_epi64x(lowCarry), 0x03);
+
+            __m256i u = _mm256_and_si256(state, mask);
+            __m256i t = _mm256_add_epi64(state, u);
+            // 无符号比较 t < state：翻转符号位后做有符号比较
+            __m256i overflow = _mm256_cmpgt_epi64(_mm256_xor_si256(state, sign), _mm256_xor_si256(t, sign));
+            __m256i sum = _mm256_add_epi64(t, carryIn);
+            __m256i wrapped = _mm256_and_si256(_mm256_cmpeq_epi64(t, allOnes), _mm256_cmpeq_epi64(carryIn, one));
+            __m256i carryOut = _mm256_and_si256(_mm256_or_si256(overflow, wrapped), one);
+            state = _mm256_or_si256(sum, _mm256_andnot_si256(mask, state));
+
+            // 通道 3 的进位留给下一组的同一行；其余通道的进位下一步右移一个通道
+            if (s >= 3) carries[s - 3] = static_cast<std::uint8_t>(_mm256_extract_epi64(carryOut, 3));
+            carryIn = _mm256_permute4x64_epi64(carryOut, _MM_SHUFFLE(2, 1, 0, 3));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(v + w0), state);
+    }
+}
+
+#endif
+
+} // namespace
+
+BitParallelLcs::BitParallelLcs(std::string_view columns)
+    : n_(columns.size()), words_((columns.size() + 63) / 64), slot_(256, -1), masks_() {
+    build(columns.data());
+}
+
+BitParallelLcs::BitParallelLcs(const std::uint32_t* columns, std::size_t n, std::size_t alphabetSize)
+    : n_(n), words_((n + 63) / 64), slot_(alphabetSize, -1), masks_() {
+    build(columns);
+}
+
+template<typename Symbol>
+void BitParallelLcs::build(const Symbol* columns) {
+    std::int32_t slots = 0;
+    for (std::size_t j = 0; j < n_; j++) {
+        std::int32_t& slot = slot_[symbolIndex(columns[j])];
+        if (slot < 0) {
+            slot = slots++;
+            masks_.resize(static_cast<std::size_t>(slots) * words_, 0);
+        }
+        masks_[static_cast<std::size_t>(slot) * words_ + j / 64] |= std::uint64_t(1) << (j % 64);
+    }
+}
+
+template<typename Symbol>
+void BitParallelLcs::advanceSymbols(std::uint64_t* v, std::size_t words, const Symbol* rows, std::size_t m,
+                                    SimdLevel level) const noexcept {
+#ifdef ALGORITHMS_HAS_LCS_AVX2
+    if (words >= AVX2_MIN_WORDS && m >= AVX2_MIN_ROWS && clampSimdLevel(level) >= SimdLevel::AVX2) {
+        std::size_t groups = words / 4;
+        const std::uint64_t* rowMasks[ROW_CHUNK + 6];
+        std::uint8_t carries[ROW_CHUNK];
+        for (std::size_t r0 = 0; r0 < m; r0 += ROW_CHUNK) {
+            std::size_t count = std::min(ROW_CHUNK, m - r0);
+            std::fill(rowMasks, rowMasks + count + 6, nullptr);
+            for (std::size_t r = 0; r < count; r++) {
+                std::int32_t slot = slot_[symbolIndex(rows[r0 + r])];
+                if (slot >= 0) rowMasks[r + 3] = &masks_[static_cast<std::size_t>(slot) * words_];
+            }
+            std::fill(carries, carries + count, 0);
+            advanceGroupsAvx2(v, groups, rowMasks, count, carries);
+
+            // 不足 4 个的剩余字用标量接着传递进位
+            for (std::size_t r = 0; r < count; r++) {
+                const std::uint64_t* mask = rowMasks[r + 3];
+                if (mask == nullptr) continue;
+                std::uint64_t carry = carries[r];
+                for (std::size_t k = groups * 4; k < words; k++) {
+                    v[k] = step(v[k], mask[k], carry);
+                }
+            }
+        }
+        return;
+    }
+#else
+    (void)level;
+#endif
+    for (std::size_t i = 0; i < m; i++) {
+        std::int32_t slot = slot_[symbolIndex(rows[i])];
+        if (slot < 0) continue;  // M[c] = 0 时 V 不变
+        const std::uint64_t* mask = &masks_[static_cast<std::size_t>(slot) * words_];
+        std::uint64_t carry = 0;
+        for (std::size_t k = 0; k < words; k++) {
+            v[k] = step(v[k], mask[k], carry);
+        }
+    }
+}
+
+void BitParallelLcs::advance(std::uint64_t* v, std::size_t words, std::string_view rows,
+                             SimdLevel level) const noexcept {
+    advanceSymbols(v, words, rows.data(), rows.size(), level);
+}
+
+void BitParallelLcs::advanceWords(std::uint64_t* v, std::size_t wordBegin, std::size_t wordEnd,
+                                  std::string_view rows, std::uint8_t* carries) const noexcept {
+    for (std::size_t i = 0; i < rows.size(); i++) {
+        std::int32_t slot = slot_[symbolIndex(rows[i])];
+        if (slot < 0) continue;  // 整行没有匹配时不会产生进位
+        const std::uint64_t* mask = &masks_[static_cast<std::size_t>(slot) * words_];
+        std::uint64_t carry = carries[i];
+        for (std::size_t k = wordBegin; k < wordEnd; k++) {
+            v[k] = step(v[k], mask[k], carry);
+        }
+        carries[i] = static_cast<std::uint8_t>(carry);
+    }
+}
+
+std::size_t BitParallelLcs::lengthFromState(const std::uint64_t* v) const noexcept {
+    if (n_ == 0) return 0;
+    // 最后一个字中超出 n 的位可能被进位改写，不参与统计
+    std::size_t ones = 0;
+    for (std::size_t k = 0; k + 1 < words_; k++) ones += popcount64(v[k]);
+    unsigned tail = static_cast<unsigned>(n_ - (words_ - 1) * 64);
+    std::uint64_t tailMask = tail == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << tail) - 1;
+    ones += popcount64(v[words_ - 1] & tailMask);
+    return n_ - ones;
+}
+
+std::size_t BitParallelLcs::length(std::string_view rows) const {
+    if (n_ == 0 || rows.empty()) return 0;
+    std::vector<std::uint64_t> v(words_, ~std::uint64_t(0));
+    advance(v.data(), words_, rows);
+    return lengthFromState(v.data());
+}
+
+std::size_t BitParallelLcs::length(const std::uint32_t* rows, std::size_t m) const {
+    if (n_ == 0 || m == 0) return 0;
+    std::vector<std::uint64_t> v(words_, ~std::uint64_t(0));
+    advanceSymbols(v.data(), words_, rows, m, detectSimdLevel());
+    return lengthFromState(v.data());
+}
+
+} // namespace detail
+} // namespace algorithms
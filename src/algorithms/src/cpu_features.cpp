@@ -0,0 +1,59 @@
+#include "algorithms/detail/cpu_features.h"
+
+#if ALGORITHMS_ARCH_X86 && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace algorithms {
+namespace detail {
+
+namespace {
+
+SimdLevel detect() noexcept {
+#if ALGORITHMS_ARCH_X86 && defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {0, 0, 0, 0};
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!sse2) return SimdLevel::Scalar;
+    if (!osxsave || maxLeaf < 7) return SimdLevel::SSE2;
+
+    // 操作系统必须保存 YMM（AVX）和 ZMM（AVX-512）寄存器状态
+    unsigned long long xcr0 = _xgetbv(0);
+    bool ymm = (xcr0 & 0x6) == 0x6;
+    bool zmm = (xcr0 & 0xe6) == 0xe6;
+
+    __cpuidex(info, 7, 0);
+    bool avx2 = (info[1] & (1 << 5)) != 0;
+    bool avx512f = (info[1] & (1 << 16)) != 0;
+    bool avx512bw = (info[1] & (1 << 30)) != 0;
+
+    if (zmm && avx512f && avx512bw) return SimdLevel::AVX512;
+    if (ymm && avx2) return SimdLevel::AVX2;
+    return SimdLevel::SSE2;
+#elif ALGORITHMS_ARCH_X86 && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+    return SimdLevel::Scalar;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+} // namespace
+
+SimdLevel detectSimdLevel() noexcept {
+    static const SimdLevel level = detect();
+    return level;
+}
+
+} // namespace detail
+} // namespace algorithms
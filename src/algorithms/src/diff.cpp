@@ -0,0 +1,246 @@
+#include "algorithms/diff.h"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace algorithms {
+
+namespace {
+
+// 按位置顺序收集编辑操作：相邻两个 Equal 之间的删除和插入各合并成一段，先删除后插入
+class ScriptBuilder {
+public:
+    void equal(std::size_t oldPos, std::size_t newPos, std::size_t length) {
+        if (length == 0) return;
+        flush();
+        if (!edits_.empty() && edits_.back().op == DiffOp::Equal) {
+            edits_.back().length += length;
+        } else {
+            edits_.push_back({DiffOp::Equal, oldPos, newPos, length});
+        }
+    }
+
+    void remove(std::size_t oldPos, std::size_t newPos, std::size_t length) {
+        if (length == 0) return;
+        if (deleted_.length == 0) deleted_ = {DiffOp::Delete, oldPos, newPos, 0};
+        deleted_.length += length;
+    }
+
+    void insert(std::size_t oldPos, std::size_t newPos, std::size_t length) {
+        if (length == 0) return;
+        if (inserted_.length == 0) inserted_ = {DiffOp::Insert, oldPos, newPos, 0};
+        inserted_.length += length;
+    }
+
+    std::vector<DiffEdit> finish() {
+        flush();
+        return std::move(edits_);
+    }
+
+private:
+    void flush() {
+        if (deleted_.length != 0) {
+            // 同时有删除和插入时：删除段位于新序列中插入段之前，插入段位于旧序列中删除段之后
+            if (inserted_.length != 0) {
+                deleted_.newStart = inserted_.newStart;
+                inserted_.oldStart = deleted_.oldStart + deleted_.length;
+            }
+            edits_.push_back(deleted_);
+        }
+        if (inserted_.length != 0) edits_.push_back(inserted_);
+        deleted_.length = 0;
+        inserted_.length = 0;
+    }
+
+    std::vector<DiffEdit> edits_;
+    DiffEdit deleted_{DiffOp::Delete, 0, 0, 0};
+    DiffEdit inserted_{DiffOp::Insert, 0, 0, 0};
+};
+
+class MyersDiff {
+public:
+    MyersDiff(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b)
+        : a_(a.data()), b_(b.data()), n_(a.size()), m_(b.size()),
+          forward_(a.size() + b.size() + 3), backward_(a.size() + b.size() + 3), script_() {}
+
+    std::vector<DiffEdit> run() {
+        compare(0, n_, 0, m_);
+        return script_.finish();
+    }
+
+private:
+    void compare(std::size_t a0, std::size_t a1, std::size_t b0, std::size_t b1) {
+        std::size_t prefix = 0;
+        while (a0 + prefix < a1 && b0 + prefix < b1 && a_[a0 + prefix] == b_[b0 + prefix]) prefix++;
+        script_.equal(a0, b0, prefix);
+        a0 += prefix;
+        b0 += prefix;
+
+        std::size_t suffix = 0;
+        while (a1 - suffix > a0 && b1 - suffix > b0 && a_[a1 - suffix - 1] == b_[b1 - suffix - 1]) suffix++;
+        a1 -= suffix;
+        b1 -= suffix;
+
+        if (a0 == a1) {
+            script_.insert(a0, b0, b1 - b0);
+        } else if (b0 == b1) {
+            script_.remove(a0, b0, a1 - a0);
+        } else {
+            std::size_t x, y;
+            if (bisect(a0, a1, b0, b1, x, y)) {
+                compare(a0, x, b0, y);
+                compare(x, a1, y, b1);
+            } else {
+                script_.remove(a0, b0, a1 - a0);
+                script_.insert(a1, b0, b1 - b0);
+            }
+        }
+
+        script_.equal(a1, b1, suffix);
+    }
+
+    // 从两端同时扩展 D 路径，找到中间蛇形的分割点 (x, y)（绝对位置）
+    bool bisect(std::size_t a0, std::size_t a1, std::size_t b0, std::size_t b1,
+                std::size_t& splitX, std::size_t& splitY) {
+        const std::uint32_t* a = a_ + a0;
+        const std::uint32_t* b = b_ + b0;
+        auto n = static_cast<std::ptrdiff_t>(a1 - a0);
+        auto m = static_cast<std::ptrdiff_t>(b1 - b0);
+        std::ptrdiff_t maxD = (n + m + 1) / 2;
+        std::ptrdiff_t offset = maxD;
+        std::ptrdiff_t length = 2 * maxD + 2;
+
+        // forward_[offset + k]：对角线 k = x - y 上前向路径到达的最远 x；
+        // backward_ 同理，但坐标从两个序列的末尾倒数
+        std::fill(forward_.begin(), forward_.begin() + length, -1);
+        std::fill(backward_.begin(), backward_.begin() + length, -1);
+        forward_[static_cast<std::size_t>(offset + 1)] = 0;
+        backward_[static_cast<std::size_t>(offset + 1)] = 0;
+
+        std::ptrdiff_t delta = n - m;
+        bool front = delta % 2 != 0;  // 奇数时在前向扩展中检测重叠
+        std::ptrdiff_t k1Start = 0, k1End = 0, k2Start = 0, k2End = 0;
+        auto at = [](std::vector<std::ptrdiff_t>& v, std::ptrdiff_t i) -> std::ptrdiff_t& {
+            return v[static_cast<std::size_t>(i)];
+        };
+
+        for (std::ptrdiff_t d = 0; d < maxD; d++) {
+            for (std::ptrdiff_t k1 = -d + k1Start; k1 <= d - k1End; k1 += 2) {
+                std::ptrdiff_t k1Offset = offset + k1;
+                std::ptrdiff_t x1;
+                if (k1 == -d || (k1 != d && at(forward_, k1Offset - 1) < at(forward_, k1Offset + 1))) {
+                    x1 = at(forward_, k1Offset + 1);
+                } else {
+                    x1 = at(forward_, k1Offset - 1) + 1;
+                }
+                std::ptrdiff_t y1 = x1 - k1;
+                while (x1 < n && y1 < m && a[x1] == b[y1]) {
+                    x1++;
+                    y1++;
+                }
+                at(forward_, k1Offset) = x1;
+                if (x1 > n) {
+                    k1End += 2;  // 越过右边界
+                } else if (y1 > m) {
+                    k1Start += 2;  // 越过下边界
+                } else if (front) {
+                    std::ptrdiff_t k2Offset = offset + delta - k1;
+                    if (k2Offset >= 0 && k2Offset < length && at(backward_, k2Offset) != -1) {
+                        std::ptrdiff_t x2 = n - at(backward_, k2Offset);
+                        if (x1 >= x2) {
+                            splitX = a0 + static_cast<std::size_t>(x1);
+                            splitY = b0 + static_cast<std::size_t>(y1);
+                            return true;
+                        }
+                    }
+                }
+            }
+
+            for (std::ptrdiff_t k2 = -d + k2Start; k2 <= d - k2End; k2 += 2) {
+                std::ptrdiff_t k2Offset = offset + k2;
+                std::ptrdiff_t x2;
+                if (k2 == -d || (k2 != d && at(backward_, k2Offset - 1) < at(backward_, k2Offset + 1))) {
+                    x2 = at(backward_, k2Offset + 1);
+                } else {
+                    x2 = at(backward_, k2Offset - 1) + 1;
+                }
+                std::ptrdiff_t y2 = x2 - k2;
+                while (x2 < n && y2 < m && a[n - x2 - 1] == b[m - y2 - 1]) {
+                    x2++;
+                    y2++;
+                }
+                at(backward_, k2Offset) = x2;
+                if (x2 > n) {
+                    k2End += 2;
+                } else if (y2 > m) {
+                    k2Start += 2;
+                } else if (!front) {
+                    std::ptrdiff_t k1Offset = offset + delta - k2;
+                    if (k1Offset >= 0 && k1Offset < length && at(forward_, k1Offset) != -1) {
+                        std::ptrdiff_t x1 = at(forward_, k1Offset);
+                        std::ptrdiff_t y1 = offset + x1 - k1Offset;
+                        if (x1 >= n - x2) {
+                            splitX = a0 + static_cast<std::size_t>(x1);
+                            splitY = b0 + static_cast<std::size_t>(y1);
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    const std::uint32_t* a_;
+    const std::uint32_t* b_;
+    std::size_t n_;
+    std::size_t m_;
+    std::vector<std::ptrdiff_t> forward_;
+    std::vector<std::ptrdiff_t> backward_;
+    ScriptBuilder script_;
+};
+
+} // namespace
+
+std::vector<DiffEdit> myersDiff(const std::vector<std::uint32_t>& oldSeq,
+                                const std::vector<std::uint32_t>& newSeq) {
+    return MyersDiff(oldSeq, newSeq).run();
+}
+
+std::vector<DiffEdit> diffStrings(std::string_view oldText, std::string_view newText) {
+    // 字节本身就是稠密编号，不需要驻留
+    auto toIds = [](std::string_view text) {
+        std::vector<std::uint32_t> ids(text.size());
+        for (std::size_t i = 0; i < text.size(); i++) ids[i] = static_cast<unsigned char>(text[i]);
+        return ids;
+    };
+    return myersDiff(toIds(oldText), toIds(newText));
+}
+
+std::vector<std::string_view> splitLines(std::string_view text) {
+    std::vector<std::string_view> lines;
+    std::size_t start = 0;
+    while (start < text.size()) {
+        std::size_t end = text.find('\n', start);
+        if (end == std::string_view::npos) end = text.size();
+        std::size_t stop = end;
+        if (stop > start && text[stop - 1] == '\r') stop--;
+        lines.push_back(text.substr(start, stop - start));
+        start = end + 1;
+    }
+    return lines;
+}
+
+std::vector<DiffEdit> diffLines(std::string_view oldText, std::string_view newText) {
+    return diffSequences(splitLines(oldText), splitLines(newText));
+}
+
+std::size_t diffDistance(const std::vector<DiffEdit>& script) {
+    std::size_t distance = 0;
+    for (const DiffEdit& edit : script) {
+        if (edit.op != DiffOp::Equal) distance += edit.length;
+    }
+    return distance;
+}
+
+} // namespace algorithms
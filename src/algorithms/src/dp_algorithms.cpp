@@ -1,11 +1,20 @@
 #include "algorithms/dp_algorithms.h"
+#include "algorithms/detail/bit_ops.h"
+#include "algorithms/detail/bit_parallel_lcs.h"
+#include "algorithms/detail/dp_kernels.h"
 #include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <stdexcept>
+#include <string_view>
+#include <utility>
 
 namespace algorithms {
 
-int knapsack01(const std::vector<int>& weights, const std::vector<int>& values, int capacity) {
-    // 输入验证
+namespace {
+
+void validateKnapsackInput(const std::vector<int>& weights, const std::vector<int>& values, int capacity) {
     if (weights.size() != values.size()) {
         throw std::invalid_argument("权重数组和价值数组的大小必须一致");
     }
@@ -17,86 +26,719 @@ int knapsack01(const std::vector<int>& weights, const std::vector<int>& values,
     if (capacity > 100000) {
         throw std::invalid_argument("背包容量过大（最大支持100000）");
     }
+
+    for (int weight : weights) {
+        if (weight < 0) {
+            throw std::invalid_argument("物品重量不能为负数");
+        }
+    }
+}
+
+} // namespace
+
+int knapsack01(const std::vector<int>& weights, const std::vector<int>& values, int capacity) {
+    // 输入验证
+    validateKnapsackInput(weights, values, capacity);
     
     int n = static_cast<int>(weights.size());
-    if (n == 0 || capacity <= 0) return 0;
+    if (n == 0) return 0;
 
-    // dp[i][w] 表示前i个物品，容量为w时的最大价值
-    std::vector<std::vector<int>> dp(n + 1, std::vector<int>(capacity + 1, 0));
+    // dp[w] 表示已处理的物品在容量为w时的最大价值；
+    // 容量从大到小更新，保证 dp[w - weight] 仍是上一个物品的结果
+    std::vector<std::int32_t> dp(static_cast<std::size_t>(capacity) + 1, 0);
+    detail::SimdLevel level = detail::detectSimdLevel();
 
-    for (int i = 1; i <= n; i++) {
-        for (int w = 1; w <= capacity; w++) {
-            if (weights[i - 1] <= w) {
-                dp[i][w] = std::max(dp[i - 1][w],
-                                   dp[i - 1][w - weights[i - 1]] + values[i - 1]);
-            } else {
-                dp[i][w] = dp[i - 1][w];
+    for (int i = 0; i < n; i++) {
+        detail::knapsackRelax(dp.data(), static_cast<std::size_t>(capacity),
+                              static_cast<std::size_t>(weights[i]), values[i], nullptr, level);
+    }
+
+    return dp[capacity];
+}
+
+KnapsackSolution knapsack01WithItems(const std::vector<int>& weights, const std::vector<int>& values,
+                                     int capacity) {
+    validateKnapsackInput(weights, values, capacity);
+
+    KnapsackSolution solution{0, {}};
+    int n = static_cast<int>(weights.size());
+    if (n == 0) return solution;
+
+    // taken 的第 i 行第 w 位：物品 i 放入后容量 w 的价值严格增大
+    std::size_t rowWords = (static_cast<std::size_t>(capacity) + 64) / 64;
+    std::vector<std::uint64_t> taken(static_cast<std::size_t>(n) * rowWords, 0);
+    std::vector<std::int32_t> dp(static_cast<std::size_t>(capacity) + 1, 0);
+    detail::SimdLevel level = detail::detectSimdLevel();
+
+    for (int i = 0; i < n; i++) {
+        detail::knapsackRelax(dp.data(), static_cast<std::size_t>(capacity),
+                              static_cast<std::size_t>(weights[i]), values[i],
+                              &taken[static_cast<std::size_t>(i) * rowWords], level);
+    }
+
+    // 从最后一个物品倒序回溯
+    int w = capacity;
+    for (int i = n - 1; i >= 0; i--) {
+        const std::uint64_t* row = &taken[static_cast<std::size_t>(i) * rowWords];
+        if ((row[w / 64] >> (w % 64)) & 1) {
+            solution.selectedItems.push_back(i);
+            w -= weights[i];
+        }
+    }
+    std::reverse(solution.selectedItems.begin(), solution.selectedItems.end());
+    solution.maxValue = dp[capacity];
+    return solution;
+}
+
+namespace {
+
+// 子集和位集：bit s 表示重量和 s 可达；stopAtTarget 为 true 时 target 可达即停止
+std::vector<std::uint64_t> reachableSums(const std::vector<int>& weights, int limit, bool stopAtTarget) {
+    if (limit < 0) {
+        throw std::invalid_argument("目标和不能为负数");
+    }
+    for (int weight : weights) {
+        if (weight < 0) {
+            throw std::invalid_argument("物品重量不能为负数");
+        }
+    }
+
+    std::size_t bitsCount = static_cast<std::size_t>(limit) + 1;
+    std::size_t words = (bitsCount + 63) / 64;
+    std::vector<std::uint64_t> reachable(words, 0);
+    reachable[0] = 1;
+
+    detail::SimdLevel level = detail::detectSimdLevel();
+    std::size_t targetWord = static_cast<std::size_t>(limit) / 64;
+    std::uint64_t targetBit = std::uint64_t(1) << (limit % 64);
+    std::size_t maxSum = 0;  // 目前可达的最大和，只需更新它覆盖的字
+    for (int weight : weights) {
+        if (weight == 0 || weight > limit) continue;
+        maxSum = std::min(maxSum + static_cast<std::size_t>(weight), static_cast<std::size_t>(limit));
+        detail::shiftOrBitset(reachable.data(), maxSum / 64 + 1, static_cast<std::size_t>(weight), level);
+        if (stopAtTarget && (reachable[targetWord] & targetBit)) break;
+    }
+
+    // 清除超出 limit 的位
+    std::size_t tailBits = bitsCount % 64;
+    if (tailBits != 0) {
+        reachable[words - 1] &= (std::uint64_t(1) << tailBits) - 1;
+    }
+    return reachable;
+}
+
+} // namespace
+
+bool subsetSum(const std::vector<int>& weights, int target) {
+    std::vector<std::uint64_t> reachable = reachableSums(weights, target, true);
+    return (reachable[static_cast<std::size_t>(target) / 64] >> (target % 64)) & 1;
+}
+
+int closestSubsetSum(const std::vector<int>& weights, int capacity) {
+    std::vector<std::uint64_t> reachable = reachableSums(weights, capacity, false);
+    for (std::size_t w = reachable.size(); w-- > 0;) {
+        if (reachable[w] != 0) {
+            return static_cast<int>(w * 64 + detail::highestBit64(reachable[w]));
+        }
+    }
+    return 0;
+}
+
+namespace {
+
+// 自动选择时 DP 表格的规模上限（格数），以及显式指定 DP 时允许的最大规模
+constexpr unsigned long long DP_AUTO_CELL_LIMIT = 1ULL << 27;
+constexpr unsigned long long DP_HARD_CELL_LIMIT = 1ULL << 32;
+// Auto 下分支限界未完成时，仍可接受的精确 DP 表格规模（选择标记共 128MB）
+constexpr unsigned long long DP_FALLBACK_CELL_LIMIT = 1ULL << 30;
+constexpr std::size_t PARETO_MAX_ITEMS = 20;
+// Auto 下分支限界最多展开的结点数，以及随后 Pareto 前沿最多处理的状态数（合并次数）
+constexpr std::size_t BRANCH_AND_BOUND_AUTO_NODE_LIMIT = std::size_t(1) << 22;
+constexpr std::size_t PARETO_AUTO_WORK_LIMIT = std::size_t(1) << 22;
+constexpr std::size_t UNLIMITED = static_cast<std::size_t>(-1);
+
+struct LargeItem {
+    long long weight;
+    long long value;
+    int index;
+};
+
+// 预处理后的大容量背包：剔除无用物品，零重量的正价值物品直接放入
+struct PreparedKnapsack {
+    std::vector<LargeItem> items;
+    std::vector<int> alwaysTaken;
+    long long baseValue;
+    long long valueSum;  ///< items 的价值之和
+};
+
+PreparedKnapsack prepareLargeKnapsack(const std::vector<long long>& weights,
+                                      const std::vector<long long>& values, long long capacity) {
+    if (weights.size() != values.size()) {
+        throw std::invalid_argument("权重数组和价值数组的大小必须一致");
+    }
+    if (capacity < 0) {
+        throw std::invalid_argument("背包容量不能为负数");
+    }
+
+    PreparedKnapsack prepared{{}, {}, 0, 0};
+    long long total = 0;
+    for (std::size_t i = 0; i < weights.size(); i++) {
+        if (weights[i] < 0) {
+            throw std::invalid_argument("物品重量不能为负数");
+        }
+        if (values[i] <= 0) continue;
+        if (values[i] > LLONG_MAX - total) {
+            throw std::invalid_argument("物品总价值超出long long范围");
+        }
+        total += values[i];
+
+        if (weights[i] > capacity) continue;
+        if (weights[i] == 0) {
+            prepared.alwaysTaken.push_back(static_cast<int>(i));
+            prepared.baseValue += values[i];
+        } else {
+            prepared.items.push_back({weights[i], values[i], static_cast<int>(i)});
+            prepared.valueSum += values[i];
+        }
+    }
+    return prepared;
+}
+
+// n * (range + 1)，超过 limit 时返回 limit + 1
+unsigned long long tableCells(std::size_t n, long long range, unsigned long long limit) {
+    unsigned long long columns = static_cast<unsigned long long>(range) + 1;
+    if (n == 0) return columns;
+    if (columns > limit / n) return limit + 1;
+    return columns * n;
+}
+
+// 比较 a*b 与 c*d（均非负），避免 64 位乘法溢出
+int compareProducts(long long a, long long b, long long c, long long d) {
+    auto multiply = [](unsigned long long x, unsigned long long y) {
+        unsigned long long x0 = x & 0xffffffffULL, x1 = x >> 32;
+        unsigned long long y0 = y & 0xffffffffULL, y1 = y >> 32;
+        unsigned long long low = x0 * y0;
+        unsigned long long mid1 = x1 * y0;
+        unsigned long long mid2 = x0 * y1;
+        unsigned long long high = x1 * y1;
+        unsigned long long carry = ((low >> 32) + (mid1 & 0xffffffffULL) + (mid2 & 0xffffffffULL)) >> 32;
+        unsigned long long lo = low + (mid1 << 32) + (mid2 << 32);
+        unsigned long long hi = high + (mid1 >> 32) + (mid2 >> 32) + carry;
+        return std::make_pair(hi, lo);
+    };
+    auto left = multiply(static_cast<unsigned long long>(a), static_cast<unsigned long long>(b));
+    auto right = multiply(static_cast<unsigned long long>(c), static_cast<unsigned long long>(d));
+    if (left == right) return 0;
+    return left < right ? -1 : 1;
+}
+
+// 按容量的 DP：dp[w] 为容量 w 下的最大价值，每格 1 位记录是否放入
+LargeKnapsackSolution solveByCapacity(const std::vector<LargeItem>& items, long long capacity) {
+    std::size_t columns = static_cast<std::size_t>(capacity) + 1;
+    std::size_t rowWords = (columns + 63) / 64;
+    std::vector<std::int64_t> dp(columns, 0);
+    std::vector<std::uint64_t> taken(items.size() * rowWords, 0);
+    detail::SimdLevel level = detail::detectSimdLevel();
+
+    for (std::size_t i = 0; i < items.size(); i++) {
+        detail::knapsackRelax(dp.data(), columns - 1, static_cast<std::size_t>(items[i].weight),
+                              static_cast<std::int64_t>(items[i].value), &taken[i * rowWords], level);
+    }
+
+    LargeKnapsackSolution solution{dp[columns - 1], {}};
+    std::size_t w = columns - 1;
+    for (std::size_t i = items.size(); i-- > 0;) {
+        if ((taken[i * rowWords + w / 64] >> (w % 64)) & 1) {
+            solution.selectedItems.push_back(items[i].index);
+            w -= static_cast<std::size_t>(items[i].weight);
+        }
+    }
+    return solution;
+}
+
+// 按价值的 DP：dp[v] 为恰好得到价值 v 的最小重量
+LargeKnapsackSolution solveByValue(const std::vector<LargeItem>& items, long long valueSum,
+                                   long long capacity) {
+    const long long INF = LLONG_MAX;
+    std::size_t columns = static_cast<std::size_t>(valueSum) + 1;
+    std::size_t rowWords = (columns + 63) / 64;
+    std::vector<long long> dp(columns, INF);
+    std::vector<std::uint64_t> taken(items.size() * rowWords, 0);
+    dp[0] = 0;
+
+    std::size_t reachable = 0;  // 目前可能达到的最大价值
+    for (std::size_t i = 0; i < items.size(); i++) {
+        long long weight = items[i].weight;
+        std::size_t value = static_cast<std::size_t>(items[i].value);
+        std::uint64_t* row = &taken[i * rowWords];
+        reachable += value;
+        for (std::size_t v = reachable; v >= value; v--) {
+            long long previous = dp[v - value];
+            if (previous != INF && previous <= capacity - weight && previous + weight < dp[v]) {
+                dp[v] = previous + weight;
+                row[v / 64] |= std::uint64_t(1) << (v % 64);
             }
         }
     }
 
-    return dp[n][capacity];
+    std::size_t best = columns - 1;
+    while (dp[best] > capacity) best--;
+
+    LargeKnapsackSolution solution{static_cast<long long>(best), {}};
+    std::size_t v = best;
+    for (std::size_t i = items.size(); i-- > 0;) {
+        if ((taken[i * rowWords + v / 64] >> (v % 64)) & 1) {
+            solution.selectedItems.push_back(items[i].index);
+            v -= static_cast<std::size_t>(items[i].value);
+        }
+    }
+    return solution;
 }
 
-int longestCommonSubsequence(const std::string& s1, const std::string& s2) {
-    int m = static_cast<int>(s1.length());
-    int n = static_cast<int>(s2.length());
+// Pareto 前沿：按重量升序、价值严格递增的非支配状态表。
+// 处理的状态总数超过 workLimit 时放弃并返回 false
+bool solveByPareto(const std::vector<LargeItem>& items, long long capacity, std::size_t workLimit,
+                   LargeKnapsackSolution& solution) {
+    struct State {
+        long long weight;
+        long long value;
+        std::size_t parent;  ///< 放入 item 之前的状态
+        int item;
+    };
+    const std::size_t NO_PARENT = static_cast<std::size_t>(-1);
+    std::vector<State> arena = {{0, 0, NO_PARENT, -1}};
+    std::vector<std::size_t> frontier = {0};
+    std::vector<std::size_t> merged;
+    std::size_t work = 0;
 
-    if (m == 0 || n == 0) return 0;
+    for (const LargeItem& item : items) {
+        work += frontier.size();
+        if (work > workLimit) return false;
+        merged.clear();
+        long long lastValue = -1;
+        std::size_t a = 0;  // 不放入 item 的状态
+        std::size_t b = 0;  // 放入 item 的状态（由 frontier[b] 平移得到）
+        auto shiftedFits = [&](std::size_t k) {
+            return k < frontier.size() && arena[frontier[k]].weight <= capacity - item.weight;
+        };
 
-    // dp[i][j] 表示s1[0..i-1]和s2[0..j-1]的最长公共子序列长度
-    std::vector<std::vector<int>> dp(m + 1, std::vector<int>(n + 1, 0));
+        while (a < frontier.size() || shiftedFits(b)) {
+            bool takeShifted;
+            if (a >= frontier.size()) {
+                takeShifted = true;
+            } else if (!shiftedFits(b)) {
+                takeShifted = false;
+            } else {
+                const State& old = arena[frontier[a]];
+                const State& base = arena[frontier[b]];
+                long long shiftedWeight = base.weight + item.weight;
+                long long shiftedValue = base.value + item.value;
+                // 重量相同时价值大的在前，后面的自然被支配
+                takeShifted = shiftedWeight < old.weight ||
+                              (shiftedWeight == old.weight && shiftedValue > old.value);
+            }
 
-    for (int i = 1; i <= m; i++) {
-        for (int j = 1; j <= n; j++) {
-            if (s1[i - 1] == s2[j - 1]) {
-                dp[i][j] = dp[i - 1][j - 1] + 1;
+            if (takeShifted) {
+                const State& base = arena[frontier[b]];
+                long long value = base.value + item.value;
+                if (value > lastValue) {
+                    arena.push_back({base.weight + item.weight, value, frontier[b], item.index});
+                    merged.push_back(arena.size() - 1);
+                    lastValue = value;
+                }
+                b++;
             } else {
-                dp[i][j] = std::max(dp[i - 1][j], dp[i][j - 1]);
+                if (arena[frontier[a]].value > lastValue) {
+                    merged.push_back(frontier[a]);
+                    lastValue = arena[frontier[a]].value;
+                }
+                a++;
             }
         }
+        frontier.swap(merged);
     }
 
-    return dp[m][n];
+    const State& best = arena[frontier.back()];
+    solution = LargeKnapsackSolution{best.value, {}};
+    for (std::size_t s = frontier.back(); arena[s].parent != NO_PARENT; s = arena[s].parent) {
+        solution.selectedItems.push_back(arena[s].item);
+    }
+    return true;
 }
 
-std::string getLongestCommonSubsequence(const std::string& s1, const std::string& s2) {
-    int m = static_cast<int>(s1.length());
-    int n = static_cast<int>(s2.length());
+// 分支限界：按价值密度降序深度优先，先尝试放入；分数背包贪心解为上界。
+// 用显式栈代替递归，物品数很多时也不会耗尽调用栈
+class BranchAndBoundSolver {
+public:
+    BranchAndBoundSolver(std::vector<LargeItem> items, long long capacity)
+        : items_(std::move(items)), capacity_(capacity), bestValue_(0) {
+        std::sort(items_.begin(), items_.end(), [](const LargeItem& a, const LargeItem& b) {
+            return compareProducts(a.value, b.weight, b.value, a.weight) > 0;
+        });
+        // 重量前缀和可能超出 64 位，饱和到 ULLONG_MAX；价值之和已校验不会溢出
+        prefixWeight_.assign(items_.size() + 1, 0);
+        prefixValue_.assign(items_.size() + 1, 0);
+        for (std::size_t i = 0; i < items_.size(); i++) {
+            unsigned long long weight = static_cast<unsigned long long>(items_[i].weight);
+            prefixWeight_[i + 1] = prefixWeight_[i] > ULLONG_MAX - weight ? ULLONG_MAX : prefixWeight_[i] + weight;
+            prefixValue_[i + 1] = prefixValue_[i] + items_[i].value;
+        }
+        suffixMinWeight_.assign(items_.size() + 1, LLONG_MAX);
+        for (std::size_t i = items_.size(); i-- > 0;) {
+            suffixMinWeight_[i] = std::min(suffixMinWeight_[i + 1], items_[i].weight);
+        }
+    }
 
-    if (m == 0 || n == 0) return "";
+    // 按价值密度降序排列的物品
+    const std::vector<LargeItem>& items() const { return items_; }
 
-    // dp[i][j] 表示s1[0..i-1]和s2[0..j-1]的最长公共子序列长度
-    std::vector<std::vector<int>> dp(m + 1, std::vector<int>(n + 1, 0));
+    /**
+     * 搜索至多 nodeLimit 个结点，solution 为目前找到的最好解。
+     * 返回 true 表示搜索完成、solution 是最优解
+     */
+    bool solve(std::size_t nodeLimit, LargeKnapsackSolution& solution) {
+        std::size_t n = items_.size();
+        std::vector<bool> current(n, false);
+        std::vector<bool> best(n, false);
+        bestValue_ = 0;
 
-    for (int i = 1; i <= m; i++) {
-        for (int j = 1; j <= n; j++) {
-            if (s1[i - 1] == s2[j - 1]) {
-                dp[i][j] = dp[i - 1][j - 1] + 1;
-            } else {
-                dp[i][j] = std::max(dp[i - 1][j], dp[i][j - 1]);
+        // 结点表示已决定前 depth 个物品，taken 为第 depth-1 个物品是否放入。
+        // 不放入的分支先入栈，因此先展开放入的分支；弹出结点时它的祖先都还在
+        // current 的前缀里，更深的位置只被已经结束的兄弟子树写过
+        struct Node {
+            std::size_t depth;
+            long long remaining;
+            long long value;
+            bool taken;
+        };
+        std::vector<Node> stack = {{0, capacity_, 0, false}};
+        // 更新最好解时只复制上次复制之后 current 被改写的区间，均摊每个结点 O(1)
+        std::size_t dirtyFrom = 0;
+        std::size_t bestDepth = 0;
+        std::size_t nodes = 0;
+        bool complete = true;
+        while (!stack.empty()) {
+            if (nodes++ == nodeLimit) {
+                complete = false;
+                break;
+            }
+            Node node = stack.back();
+            stack.pop_back();
+            if (node.depth > 0) {
+                current[node.depth - 1] = node.taken;
+                dirtyFrom = std::min(dirtyFrom, node.depth - 1);
+            }
+            if (node.value > bestValue_) {
+                bestValue_ = node.value;
+                for (std::size_t i = std::min(dirtyFrom, node.depth); i < node.depth; i++) best[i] = current[i];
+                for (std::size_t i = node.depth; i < bestDepth; i++) best[i] = false;
+                bestDepth = node.depth;
+                dirtyFrom = n;
             }
+            // 剩余物品都放不下时子树里不会有更好的解
+            if (node.depth == n || node.remaining < suffixMinWeight_[node.depth] ||
+                node.value + upperBound(node.depth, node.remaining) <= bestValue_) {
+                continue;
+            }
+
+            const LargeItem& item = items_[node.depth];
+            stack.push_back({node.depth + 1, node.remaining, node.value, false});
+            if (item.weight <= node.remaining) {
+                stack.push_back({node.depth + 1, node.remaining - item.weight, node.value + item.value, true});
+            }
+        }
+
+        solution = LargeKnapsackSolution{bestValue_, {}};
+        for (std::size_t i = 0; i < n; i++) {
+            if (best[i]) solution.selectedItems.push_back(items_[i].index);
         }
+        return complete;
     }
 
-    // 重建LCS
-    std::string lcs;
-    int i = m, j = n;
-    while (i > 0 && j > 0) {
-        if (s1[i - 1] == s2[j - 1]) {
-            lcs.push_back(s1[i - 1]);
-            i--;
-            j--;
-        } else if (dp[i - 1][j] > dp[i][j - 1]) {
-            i--;
-        } else {
-            j--;
+private:
+    // 从第 i 个物品起，剩余容量 remaining 时可能得到的最大附加价值（向上取整的松弛解）。
+    // 能整个放入的是一段连续前缀，用前缀和二分找到它的末尾，O(log n)
+    long long upperBound(std::size_t i, long long remaining) const {
+        unsigned long long base = prefixWeight_[i];
+        if (base >= ULLONG_MAX - static_cast<unsigned long long>(remaining)) {
+            return linearUpperBound(i, remaining);
+        }
+        unsigned long long limit = base + static_cast<unsigned long long>(remaining);
+        std::size_t j = static_cast<std::size_t>(
+            std::upper_bound(prefixWeight_.begin() + static_cast<std::ptrdiff_t>(i), prefixWeight_.end(), limit) -
+            prefixWeight_.begin()) - 1;
+        long long bound = prefixValue_[j] - prefixValue_[i];
+        if (j == items_.size()) return bound;
+        return bound + fractionalValue(items_[j], static_cast<long long>(limit - prefixWeight_[j]));
+    }
+
+    // 重量前缀和饱和时退回逐个累加（只在总重量超出 64 位时出现）
+    long long linearUpperBound(std::size_t i, long long remaining) const {
+        long long bound = 0;
+        for (; i < items_.size(); i++) {
+            if (items_[i].weight > remaining) return bound + fractionalValue(items_[i], remaining);
+            remaining -= items_[i].weight;
+            bound += items_[i].value;
+        }
+        return bound;
+    }
+
+    // 部分装入一个物品的价值；浮点误差用少量余量覆盖，上界只能偏大
+    static long long fractionalValue(const LargeItem& item, long long remaining) {
+        long double fraction = static_cast<long double>(remaining) * item.value / item.weight;
+        long long extra = static_cast<long long>(fraction * (1.0L + 1e-9L)) + 1;
+        return std::min(extra, item.value);
+    }
+
+    std::vector<LargeItem> items_;
+    long long capacity_;
+    std::vector<unsigned long long> prefixWeight_;
+    std::vector<long long> prefixValue_;
+    std::vector<long long> suffixMinWeight_;
+    long long bestValue_;
+};
+
+// 近似解：价值按比例缩小到 n * Σ⌊v/K⌋ 不超过 DP_AUTO_CELL_LIMIT 后做按价值的 DP，
+// 缩小后为 0 的物品再按密度顺序贪心补进剩余容量。缩放损失不超过 n * K
+LargeKnapsackSolution solveByScaledValue(const std::vector<LargeItem>& sortedItems, long long valueSum,
+                                         long long capacity) {
+    std::size_t n = sortedItems.size();
+    long long columns = static_cast<long long>(std::max<unsigned long long>(DP_AUTO_CELL_LIMIT / n, 1));
+    long long scale = valueSum / columns + 1;
+
+    std::vector<LargeItem> scaled;
+    long long scaledSum = 0;
+    for (std::size_t k = 0; k < n; k++) {
+        long long value = sortedItems[k].value / scale;
+        if (value > 0) {
+            scaled.push_back({sortedItems[k].weight, value, static_cast<int>(k)});
+            scaledSum += value;
+        }
+    }
+
+    std::vector<bool> chosen(n, false);
+    long long weight = 0;
+    if (!scaled.empty()) {
+        for (int k : solveByValue(scaled, scaledSum, capacity).selectedItems) {
+            chosen[static_cast<std::size_t>(k)] = true;
+            weight += sortedItems[static_cast<std::size_t>(k)].weight;
+        }
+    }
+    for (std::size_t k = 0; k < n; k++) {
+        if (!chosen[k] && sortedItems[k].weight <= capacity - weight) {
+            chosen[k] = true;
+            weight += sortedItems[k].weight;
+        }
+    }
+
+    LargeKnapsackSolution solution{0, {}};
+    for (std::size_t k = 0; k < n; k++) {
+        if (chosen[k]) {
+            solution.maxValue += sortedItems[k].value;
+            solution.selectedItems.push_back(sortedItems[k].index);
+        }
+    }
+    return solution;
+}
+
+// Auto 在表格过大、物品又多时的求解顺序：限定结点数的分支限界，放宽规模的精确 DP，
+// 限定规模的 Pareto；都没有完成时取分支限界的当前最好解与缩放 DP 近似解中较好者
+LargeKnapsackSolution solveWithinBudget(const PreparedKnapsack& prepared, long long capacity) {
+    BranchAndBoundSolver solver(prepared.items, capacity);
+    LargeKnapsackSolution incumbent{0, {}};
+    if (solver.solve(BRANCH_AND_BOUND_AUTO_NODE_LIMIT, incumbent)) return incumbent;
+
+    std::size_t n = prepared.items.size();
+    unsigned long long byCapacity = tableCells(n, capacity, DP_FALLBACK_CELL_LIMIT);
+    unsigned long long byValue = tableCells(n, prepared.valueSum, DP_FALLBACK_CELL_LIMIT);
+    if (std::min(byCapacity, byValue) <= DP_FALLBACK_CELL_LIMIT) {
+        return byCapacity <= byValue ? solveByCapacity(prepared.items, capacity)
+                                     : solveByValue(prepared.items, prepared.valueSum, capacity);
+    }
+
+    LargeKnapsackSolution exact{0, {}};
+    if (solveByPareto(prepared.items, capacity, PARETO_AUTO_WORK_LIMIT, exact)) return exact;
+
+    LargeKnapsackSolution approximate = solveByScaledValue(solver.items(), prepared.valueSum, capacity);
+    LargeKnapsackSolution& best = approximate.maxValue > incumbent.maxValue ? approximate : incumbent;
+    best.optimal = false;
+    return best;
+}
+
+KnapsackSolver chooseSolver(const PreparedKnapsack& prepared, long long capacity) {
+    std::size_t n = prepared.items.size();
+    unsigned long long byCapacity = tableCells(n, capacity, DP_AUTO_CELL_LIMIT);
+    unsigned long long byValue = tableCells(n, prepared.valueSum, DP_AUTO_CELL_LIMIT);
+    if (std::min(byCapacity, byValue) <= DP_AUTO_CELL_LIMIT) {
+        return byCapacity <= byValue ? KnapsackSolver::CapacityDP : KnapsackSolver::ValueDP;
+    }
+    if (n <= PARETO_MAX_ITEMS) {
+        return KnapsackSolver::Pareto;
+    }
+    return KnapsackSolver::BranchAndBound;
+}
+
+} // namespace
+
+KnapsackSolver selectKnapsackSolver(const std::vector<long long>& weights,
+                                    const std::vector<long long>& values, long long capacity) {
+    return chooseSolver(prepareLargeKnapsack(weights, values, capacity), capacity);
+}
+
+LargeKnapsackSolution knapsack01Large(const std::vector<long long>& weights,
+                                      const std::vector<long long>& values, long long capacity,
+                                      KnapsackSolver solver) {
+    PreparedKnapsack prepared = prepareLargeKnapsack(weights, values, capacity);
+    bool automatic = solver == KnapsackSolver::Auto;
+    if (automatic) {
+        solver = chooseSolver(prepared, capacity);
+    }
+
+    LargeKnapsackSolution solution{0, {}};
+    if (!prepared.items.empty()) {
+        switch (solver) {
+            case KnapsackSolver::CapacityDP:
+                if (tableCells(prepared.items.size(), capacity, DP_HARD_CELL_LIMIT) > DP_HARD_CELL_LIMIT) {
+                    throw std::invalid_argument("按容量的动态规划表格过大");
+                }
+                solution = solveByCapacity(prepared.items, capacity);
+                break;
+            case KnapsackSolver::ValueDP:
+                if (tableCells(prepared.items.size(), prepared.valueSum, DP_HARD_CELL_LIMIT) > DP_HARD_CELL_LIMIT) {
+                    throw std::invalid_argument("按价值的动态规划表格过大");
+                }
+                solution = solveByValue(prepared.items, prepared.valueSum, capacity);
+                break;
+            case KnapsackSolver::Pareto:
+                solveByPareto(prepared.items, capacity, UNLIMITED, solution);
+                break;
+            case KnapsackSolver::BranchAndBound:
+            case KnapsackSolver::Auto:
+            default:
+                if (automatic) {
+                    solution = solveWithinBudget(prepared, capacity);
+                } else {
+                    BranchAndBoundSolver(prepared.items, capacity).solve(UNLIMITED, solution);
+                }
+                break;
         }
     }
 
-    // 反转字符串
-    std::reverse(lcs.begin(), lcs.end());
-    return lcs;
+    solution.maxValue += prepared.baseValue;
+    solution.selectedItems.insert(solution.selectedItems.end(), prepared.alwaysTaken.begin(),
+                                  prepared.alwaysTaken.end());
+    std::sort(solution.selectedItems.begin(), solution.selectedItems.end());
+    return solution;
+}
+
+int longestCommonSubsequence(const std::string& s1, const std::string& s2) {
+    if (s1.empty() || s2.empty()) return 0;
+
+    // 较短的字符串作为位向量的列，掩码和状态向量更小
+    const std::string& rows = s1.size() >= s2.size() ? s1 : s2;
+    const std::string& columns = s1.size() >= s2.size() ? s2 : s1;
+    return static_cast<int>(detail::BitParallelLcs(columns).length(rows));
+}
+
+namespace {
+
+// 线性空间的 LCS 回溯：按行二分，只保存各层分割行的位并行状态向量。
+// 回溯规则与完整 DP 表相同：字符相等走对角线；否则 dp[i][j-1] == dp[i][j]
+// （即状态向量第 j-1 位为 1）时向左，否则向上。
+class LcsTracer {
+public:
+    LcsTracer(const std::string& rows, const std::string& columns)
+        : rows_(rows), columns_(columns), engine_(columns), reversed_() {}
+
+    std::string run() {
+        std::vector<std::uint64_t> initial(engine_.words(), ~std::uint64_t(0));
+        trace(0, rows_.size(), initial, columns_.size());
+        return std::string(reversed_.rbegin(), reversed_.rend());
+    }
+
+private:
+    // 回溯块最多保存的状态字数（约 256KB）
+    static constexpr std::size_t BLOCK_WORDS = std::size_t(1) << 15;
+
+    // 从 (r1, j1) 回溯到第 r0 行，top 为第 r0 行的状态向量；返回到达第 r0 行时的列
+    std::size_t trace(std::size_t r0, std::size_t r1, const std::vector<std::uint64_t>& top, std::size_t j1) {
+        std::size_t words = (j1 + 63) / 64;
+        if (words == 0 || r0 == r1) return j1;
+
+        if (r1 - r0 <= 1 || (r1 - r0 + 1) * words <= BLOCK_WORDS) {
+            return traceBlock(r0, r1, top, j1);
+        }
+
+        // 先推进到中间行，回溯下半部分得到穿过中间行的列，再回溯上半部分
+        std::size_t mid = r0 + (r1 - r0) / 2;
+        std::size_t crossing;
+        {
+            std::vector<std::uint64_t> middle(top.begin(), top.begin() + static_cast<std::ptrdiff_t>(words));
+            engine_.advance(middle.data(), words, std::string_view(rows_).substr(r0, mid - r0));
+            crossing = trace(mid, r1, middle, j1);
+        }
+        return trace(r0, mid, top, crossing);
+    }
+
+    std::size_t traceBlock(std::size_t r0, std::size_t r1, const std::vector<std::uint64_t>& top, std::size_t j1) {
+        std::size_t words = (j1 + 63) / 64;
+        std::vector<std::uint64_t> states((r1 - r0 + 1) * words);
+        std::copy(top.begin(), top.begin() + static_cast<std::ptrdiff_t>(words), states.begin());
+        for (std::size_t r = r0; r < r1; r++) {
+            std::uint64_t* next = &states[(r - r0 + 1) * words];
+            std::copy(next - words, next, next);
+            engine_.advance(next, words, std::string_view(rows_).substr(r, 1));
+        }
+
+        std::size_t i = r1;
+        std::size_t j = j1;
+        while (i > r0 && j > 0) {
+            if (rows_[i - 1] == columns_[j - 1]) {
+                reversed_.push_back(rows_[i - 1]);
+                i--;
+                j--;
+            } else if ((states[(i - r0) * words + (j - 1) / 64] >> ((j - 1) % 64)) & 1) {
+                j--;
+            } else {
+                i--;
+            }
+        }
+        return j;
+    }
+
+    const std::string& rows_;
+    const std::string& columns_;
+    detail::BitParallelLcs engine_;
+    std::string reversed_;
+};
+
+} // namespace
+
+std::string getLongestCommonSubsequence(const std::string& s1, const std::string& s2) {
+    if (s1.empty() || s2.empty()) return "";
+    return LcsTracer(s1, s2).run();
+}
+
+int editDistance(const std::string& s1, const std::string& s2) {
+    // 较短的字符串作为列，行缓冲更小
+    const std::string& rows = s1.size() >= s2.size() ? s1 : s2;
+    const std::string& columns = s1.size() >= s2.size() ? s2 : s1;
+    std::size_t n = columns.size();
+
+    std::vector<int> dp(n + 1);
+    for (std::size_t j = 0; j <= n; j++) dp[j] = static_cast<int>(j);
+
+    for (std::size_t i = 1; i <= rows.size(); i++) {
+        int diagonal = dp[0];
+        dp[0] = static_cast<int>(i);
+        for (std::size_t j = 1; j <= n; j++) {
+            int up = dp[j];
+            int substitute = diagonal + (rows[i - 1] != columns[j - 1] ? 1 : 0);
+            dp[j] = std::min(substitute, std::min(up, dp[j - 1]) + 1);
+            diagonal = up;
+        }
+    }
+    return dp[n];
 }
 
 } // namespace algorithms
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include "algorithms/detail/dp_kernels.h"
+
+#if ALGORITHMS_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace algorithms {
+namespace detail {
+
+namespace {
+
+// 处理目标字 [0, end)：bits[i] |= (bits[i - ws] << b) | (bits[i - ws - 1] >> (64 - b))
+void shiftOrScalar(std::uint64_t* bits, std::size_t end, std::size_t wordShift, unsigned bitShift) noexcept {
+    for (std::size_t i = end; i-- > wordShift;) {
+        std::uint64_t value = bits[i - wordShift] << bitShift;
+        if (bitShift != 0 && i > wordShift) {
+            value |= bits[i - wordShift - 1] >> (64 - bitShift);
+        }
+        bits[i] |= value;
+    }
+}
+
+#if ALGORITHMS_ARCH_X86 && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ALGORITHMS_HAS_DP_AVX2 1
+
+ALGORITHMS_TARGET_AVX2
+void shiftOrAvx2(std::uint64_t* bits, std::size_t words, std::size_t wordShift, unsigned bitShift) noexcept {
+    // 移位量 >= 64 时 AVX2 的移位结果为 0，因此 bitShift == 0 时无需特殊处理
+    const __m128i left = _mm_cvtsi32_si128(static_cast<int>(bitShift));
+    const __m128i right = _mm_cvtsi32_si128(static_cast<int>(64 - bitShift));
+    std::size_t i = words;
+    // 每次更新目标字 [i-4, i)，需要读取源字 [i-4-ws-1, i-ws)
+    while (i >= wordShift + 5) {
+        std::uint64_t* dst = bits + i - 4;
+        const std::uint64_t* src = bits + i - 4 - wordShift;
+        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src - 1));
+        __m256i shifted = _mm256_or_si256(_mm256_sll_epi64(current, left), _mm256_srl_epi64(previous, right));
+        __m256i target = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_or_si256(target, shifted));
+        i -= 4;
+    }
+    shiftOrScalar(bits, i, wordShift, bitShift);
+}
+
+#endif
+
+// 把 lanes 位的比较掩码写入位图中从 start 开始的位置
+inline void storeMask(std::uint64_t* takenRow, std::size_t start, std::uint64_t mask, unsigned lanes) noexcept {
+    if (takenRow == nullptr || mask == 0) return;
+    unsigned offset = static_cast<unsigned>(start % 64);
+    takenRow[start / 64] |= mask << offset;
+    if (offset + lanes > 64) {
+        takenRow[start / 64 + 1] |= mask >> (64 - offset);
+    }
+}
+
+// 标量版本：处理 w = end - 1 .. weight
+template<typename T>
+void relaxScalar(T* dp, std::size_t end, std::size_t weight, T value, std::uint64_t* takenRow) noexcept {
+    for (std::size_t w = end; w-- > weight;) {
+        T candidate = static_cast<T>(dp[w - weight] + value);
+        if (candidate > dp[w]) {
+            dp[w] = candidate;
+            if (takenRow != nullptr) takenRow[w / 64] |= std::uint64_t(1) << (w % 64);
+        }
+    }
+}
+
+#ifdef ALGORITHMS_HAS_DP_AVX2
+
+ALGORITHMS_TARGET_AVX2
+void relaxAvx2(std::int32_t* dp, std::size_t end, std::size_t weight, std::int32_t value,
+               std::uint64_t* takenRow) noexcept {
+    const __m256i add = _mm256_set1_epi32(value);
+    while (end >= weight + 8) {
+        std::size_t start = end - 8;
+        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dp + start));
+        __m256i candidate = _mm256_add_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dp + start - weight)), add);
+        if (takenRow != nullptr) {
+            __m256i greater = _mm256_cmpgt_epi32(candidate, current);
+            auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(greater)));
+            storeMask(takenRow, start, mask, 8);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dp + start), _mm256_max_epi32(current, candidate));
+        end = start;
+    }
+    relaxScalar(dp, end, weight, value, takenRow);
+}
+
+ALGORITHMS_TARGET_AVX2
+void relaxAvx2(std::int64_t* dp, std::size_t end, std::size_t weight, std::int64_t value,
+               std::uint64_t* takenRow) noexcept {
+    const __m256i add = _mm256_set1_epi64x(value);
+    while (end >= weight + 4) {
+        std::size_t start = end - 4;
+        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dp + start));
+        __m256i candidate = _mm256_add_epi64(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dp + start - weight)), add);
+        // AVX2 没有 64 位 max，用比较 + 混合代替
+        __m256i greater = _mm256_cmpgt_epi64(candidate, current);
+        if (takenRow != nullptr) {
+            auto mask = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(greater)));
+            storeMask(takenRow, start, mask, 4);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dp + start),
+                            _mm256_blendv_epi8(current, candidate, greater));
+        end = start;
+    }
+    relaxScalar(dp, end, weight, value, takenRow);
+}
+
+ALGORITHMS_TARGET_AVX512BW
+void relaxAvx512(std::int32_t* dp, std::size_t end, std::size_t weight, std::int32_t value,
+                 std::uint64_t* takenRow) noexcept {
+    const __m512i add = _mm512_set1_epi32(value);
+    while (end >= weight + 16) {
+        std::size_t start = end - 16;
+        __m512i current = _mm512_loadu_si512(dp + start);
+        __m512i candidate = _mm512_add_epi32(_mm512_loadu_si512(dp + start - weight), add);
+        if (takenRow != nullptr) {
+            storeMask(takenRow, start, _mm512_cmpgt_epi32_mask(candidate, current), 16);
+        }
+        _mm512_storeu_si512(dp + start, _mm512_max_epi32(current, candidate));
+        end = start;
+    }
+    relaxAvx2(dp, end, weight, value, takenRow);
+}
+
+ALGORITHMS_TARGET_AVX512BW
+void relaxAvx512(std::int64_t* dp, std::size_t end, std::size_t weight, std::int64_t value,
+                 std::uint64_t* takenRow) noexcept {
+    const __m512i add = _mm512_set1_epi64(value);
+    while (end >= weight + 8) {
+        std::size_t start = end - 8;
+        __m512i current = _mm512_loadu_si512(dp + start);
+        __m512i candidate = _mm512_add_epi64(_mm512_loadu_si512(dp + start - weight), add);
+        if (takenRow != nullptr) {
+            storeMask(takenRow, start, _mm512_cmpgt_epi64_mask(candidate, current), 8);
+        }
+        _mm512_storeu_si512(dp + start, _mm512_max_epi64(current, candidate));
+        end = start;
+    }
+    relaxAvx2(dp, end, weight, value, takenRow);
+}
+
+#endif
+
+template<typename T>
+void relaxDispatch(T* dp, std::size_t capacity, std::size_t weight, T value, std::uint64_t* takenRow,
+                   SimdLevel level) noexcept {
+    if (weight > capacity) return;
+#ifdef ALGORITHMS_HAS_DP_AVX2
+    switch (clampSimdLevel(level)) {
+        case SimdLevel::AVX512:
+            relaxAvx512(dp, capacity + 1, weight, value, takenRow);
+            return;
+        case SimdLevel::AVX2:
+            relaxAvx2(dp, capacity + 1, weight, value, takenRow);
+            return;
+        default:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    relaxScalar(dp, capacity + 1, weight, value, takenRow);
+}
+
+} // namespace
+
+void knapsackRelax(std::int32_t* dp, std::size_t capacity, std::size_t weight, std::int32_t value,
+                   std::uint64_t* takenRow, SimdLevel level) noexcept {
+    relaxDispatch(dp, capacity, weight, value, takenRow, level);
+}
+
+void knapsackRelax(std::int64_t* dp, std::size_t capacity, std::size_t weight, std::int64_t value,
+                   std::uint64_t* takenRow, SimdLevel level) noexcept {
+    relaxDispatch(dp, capacity, weight, value, takenRow, level);
+}
+
+void shiftOrBitset(std::uint64_t* bits, std::size_t words, std::size_t shift, SimdLevel level) noexcept {
+    std::size_t wordShift = shift / 64;
+    unsigned bitShift = static_cast<unsigned>(shift % 64);
+    if (wordShift >= words) return;
+
+#ifdef ALGORITHMS_HAS_DP_AVX2
+    if (clampSimdLevel(level) >= SimdLevel::AVX2) {
+        shiftOrAvx2(bits, words, wordShift, bitShift);
+        return;
+    }
+#else
+    (void)level;
+#endif
+    shiftOrScalar(bits, words, wordShift, bitShift);
+}
+
+} // namespace detail
+} // namespace algorithms
@@ -0,0 +1,538 @@
+#include "algorithms/fm_index.h"
+#include "algorithms/detail/bit_ops.h"
+#include <algorithm>
+#include <fstream>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace algorithms {
+
+namespace {
+
+// 文件头布局（64 位字）：标量、字节编码表、按编码的累计计数 C，
+// 之后是每个编码的 Huffman 码字和小波树内部结点表（长度由 σ 决定）
+constexpr std::uint64_t FILE_MAGIC = 0x0158444e494d4631ULL;  // "1FMINDX\x01"
+constexpr std::uint64_t FILE_VERSION = 2;
+constexpr std::size_t HEADER_MAGIC = 0;
+constexpr std::size_t HEADER_VERSION = 1;
+constexpr std::size_t HEADER_LENGTH = 2;
+constexpr std::size_t HEADER_SIGMA = 3;
+constexpr std::size_t HEADER_SAMPLE_RATE = 4;
+constexpr std::size_t HEADER_DOLLAR_ROW = 5;
+constexpr std::size_t HEADER_TREE_BITS = 6;
+constexpr std::size_t HEADER_SAMPLE_COUNT = 7;
+constexpr std::size_t HEADER_CODES = 8;
+constexpr std::size_t HEADER_COUNTS = HEADER_CODES + 256;
+constexpr std::size_t HEADER_WORDS = HEADER_COUNTS + 257;
+
+constexpr std::uint64_t NO_CODE = ~std::uint64_t(0);
+
+// Huffman 码字按 (路径 << 8) | 长度 存储；n < 2^32 时码长不超过 46
+constexpr std::size_t MAX_CODE_LENGTH = 56;
+// 结点表中孩子的最高位表示叶子，低位是叶子的编码
+constexpr std::uint32_t LEAF_FLAG = 0x80000000u;
+
+// 两级 rank 目录：每 65536 位一个超级块存绝对 rank（uint64），
+// 每 512 位一个块存相对超级块的 rank（uint16，四个打包进一个字）
+constexpr std::size_t BLOCK_BITS = 512;
+constexpr std::size_t SUPERBLOCK_BITS = 65536;
+constexpr std::size_t BLOCKS_PER_SUPERBLOCK = SUPERBLOCK_BITS / BLOCK_BITS;
+
+std::size_t bitWords(std::size_t bits) { return (bits + 63) / 64; }
+std::size_t superblockWords(std::size_t bits) { return bits / SUPERBLOCK_BITS + 1; }
+std::size_t blockWords(std::size_t bits) { return (bits / BLOCK_BITS + 4) / 4; }
+std::size_t rankedWords(std::size_t bits) { return bitWords(bits) + superblockWords(bits) + blockWords(bits); }
+std::size_t treeWords(std::size_t sigma) { return sigma + (sigma > 1 ? 2 * (sigma - 1) : 0); }
+
+std::uint16_t getPacked16(const std::uint64_t* words, std::size_t i) noexcept {
+    return static_cast<std::uint16_t>(words[i >> 2] >> ((i & 3) * 16));
+}
+
+void setPacked16(std::uint64_t* words, std::size_t i, std::uint16_t value) noexcept {
+    words[i >> 2] |= static_cast<std::uint64_t>(value) << ((i & 3) * 16);
+}
+
+std::uint32_t getPacked32(const std::uint64_t* words, std::size_t i) noexcept {
+    return static_cast<std::uint32_t>(words[i >> 1] >> ((i & 1) * 32));
+}
+
+void setPacked32(std::uint64_t* words, std::size_t i, std::uint32_t value) noexcept {
+    words[i >> 1] |= static_cast<std::uint64_t>(value) << ((i & 1) * 32);
+}
+
+// 为从 bitsOffset 开始的 bits 位填写紧随其后的超级块和块 rank 表
+void buildRankDirectory(std::uint64_t* data, std::size_t bitsOffset, std::size_t bits) {
+    std::size_t superblocks = bitsOffset + bitWords(bits);
+    std::size_t blocks = superblocks + superblockWords(bits);
+    std::size_t words = bitWords(bits);
+    std::uint64_t running = 0;
+    std::uint64_t base = 0;
+    for (std::size_t b = 0; b <= bits / BLOCK_BITS; b++) {
+        if (b % BLOCKS_PER_SUPERBLOCK == 0) {
+            base = running;
+            data[superblocks + b / BLOCKS_PER_SUPERBLOCK] = running;
+        }
+        setPacked16(data + blocks, b, static_cast<std::uint16_t>(running - base));
+        for (std::size_t w = b * 8; w < std::min(words, b * 8 + 8); w++) {
+            running += detail::popcount64(data[bitsOffset + w]);
+        }
+    }
+}
+
+// 按权重建立 Huffman 树（σ ≥ 2），内部结点按层序编号，根为 0，孩子编号大于父结点。
+// 返回每个编码的 (路径 << 8) | 长度，children 为每个内部结点的两个孩子
+std::vector<std::uint64_t> buildHuffmanTree(const std::vector<std::uint64_t>& weights,
+                                            std::vector<std::uint32_t>& children) {
+    std::size_t sigma = weights.size();
+    // 编号 < σ 的是叶子，之后是按创建顺序编号的内部结点
+    std::vector<std::pair<std::size_t, std::size_t>> merged;
+    using Entry = std::pair<std::uint64_t, std::size_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    for (std::size_t code = 0; code < sigma; code++) heap.push({weights[code], code});
+    while (heap.size() > 1) {
+        Entry a = heap.top();
+        heap.pop();
+        Entry b = heap.top();
+        heap.pop();
+        merged.push_back({a.second, b.second});
+        heap.push({a.first + b.first, sigma + merged.size() - 1});
+    }
+
+    // 从根开始层序遍历，重新编号内部结点并生成码字
+    std::vector<std::uint64_t> codes(sigma, 0);
+    children.assign(2 * (sigma - 1), 0);
+    std::vector<std::size_t> order{sigma + merged.size() - 1};
+    std::vector<std::uint64_t> paths{0};
+    std::vector<std::size_t> depths{0};
+    for (std::size_t node = 0; node < order.size(); node++) {
+        const auto& pair = merged[order[node] - sigma];
+        for (std::size_t side = 0; side < 2; side++) {
+            std::size_t child = side == 0 ? pair.first : pair.second;
+            std::uint64_t path = (paths[node] << 1) | side;
+            std::size_t depth = depths[node] + 1;
+            if (child < sigma) {
+                children[2 * node + side] = LEAF_FLAG | static_cast<std::uint32_t>(child);
+                codes[child] = (path << 8) | depth;
+            } else {
+                children[2 * node + side] = static_cast<std::uint32_t>(order.size());
+                order.push_back(child);
+                paths.push_back(path);
+                depths.push_back(depth);
+            }
+        }
+    }
+    return codes;
+}
+
+} // namespace
+
+FMIndex::FMIndex(std::string_view text, std::size_t sampleRate) {
+    if (sampleRate == 0) {
+        throw std::invalid_argument("FM索引的采样间隔必须为正数");
+    }
+    build(SuffixArray(std::string(text)), sampleRate);
+}
+
+FMIndex::FMIndex(const SuffixArray& suffixArray, std::size_t sampleRate) {
+    if (sampleRate == 0) {
+        throw std::invalid_argument("FM索引的采样间隔必须为正数");
+    }
+    build(suffixArray, sampleRate);
+}
+
+void FMIndex::build(const SuffixArray& suffixArray, std::size_t sampleRate) {
+    const std::string& text = suffixArray.text();
+    const std::vector<std::uint32_t>& sa = suffixArray.suffixes();
+    std::size_t n = text.size();
+    std::size_t rows = n + 1;  // 第 0 行是只含终止符的后缀
+
+    // 字母表压缩：出现的字节按字节值依次编码为 0..σ-1
+    std::array<std::size_t, 256> freq{};
+    for (char ch : text) freq[static_cast<unsigned char>(ch)]++;
+    std::array<std::uint64_t, 256> codes;
+    codes.fill(NO_CODE);
+    std::vector<std::uint64_t> counts;
+    for (std::size_t c = 0; c < 256; c++) {
+        if (freq[c] > 0) {
+            codes[c] = counts.size();
+            counts.push_back(freq[c]);
+        }
+    }
+    std::size_t sigma = counts.size();
+
+    // BWT：row 0 对应终止符后缀，row i+1 对应 sa[i]；终止符所在行以编码 0 占位
+    std::vector<std::uint8_t> bwt(rows, 0);
+    std::size_t dollarRow = 0;
+    if (n > 0) bwt[0] = static_cast<std::uint8_t>(codes[static_cast<unsigned char>(text[n - 1])]);
+    for (std::size_t i = 0; i < n; i++) {
+        if (sa[i] == 0) {
+            dollarRow = i + 1;
+        } else {
+            bwt[i + 1] = static_cast<std::uint8_t>(codes[static_cast<unsigned char>(text[sa[i] - 1])]);
+        }
+    }
+
+    // Huffman 小波树：占位的终止符计入编码 0 的权重；每个结点的序列按层序连续存放
+    std::vector<std::uint64_t> huffman(sigma, 0);
+    std::vector<std::uint32_t> children;
+    std::vector<std::uint64_t> nodeStart(sigma > 1 ? sigma : 1, 0);
+    std::uint64_t treeBits = 0;
+    if (sigma > 1) {
+        std::vector<std::uint64_t> weights = counts;
+        weights[0]++;
+        huffman = buildHuffmanTree(weights, children);
+        std::vector<std::uint64_t> nodeLength(sigma - 1, 0);
+        for (std::size_t code = 0; code < sigma; code++) {
+            std::size_t length = static_cast<std::size_t>(huffman[code] & 0xff);
+            std::uint64_t path = huffman[code] >> 8;
+            std::size_t node = 0;
+            for (std::size_t d = length; d-- > 0;) {
+                nodeLength[node] += weights[code];
+                std::uint32_t child = children[2 * node + ((path >> d) & 1)];
+                if (child & LEAF_FLAG) break;
+                node = child;
+            }
+        }
+        for (std::size_t node = 0; node + 1 < sigma; node++) {
+            nodeStart[node + 1] = nodeStart[node] + nodeLength[node];
+        }
+        treeBits = nodeStart[sigma - 1];
+    }
+
+    std::size_t sampleCount = n / sampleRate + 1;
+    std::size_t treeOffset = HEADER_WORDS + treeWords(sigma);
+    std::size_t markOffset = treeOffset + rankedWords(static_cast<std::size_t>(treeBits));
+    std::size_t sampleOffset = markOffset + rankedWords(rows);
+    owned_.assign(sampleOffset + (sampleCount + 1) / 2, 0);
+    std::uint64_t* data = owned_.data();
+
+    data[HEADER_MAGIC] = FILE_MAGIC;
+    data[HEADER_VERSION] = FILE_VERSION;
+    data[HEADER_LENGTH] = n;
+    data[HEADER_SIGMA] = sigma;
+    data[HEADER_SAMPLE_RATE] = sampleRate;
+    data[HEADER_DOLLAR_ROW] = dollarRow;
+    data[HEADER_TREE_BITS] = treeBits;
+    data[HEADER_SAMPLE_COUNT] = sampleCount;
+    std::copy(codes.begin(), codes.end(), data + HEADER_CODES);
+    // C[code]：BWT 中编码小于 code 的字符数，加上终止符
+    std::uint64_t running = 1;
+    for (std::size_t code = 0; code <= sigma; code++) {
+        data[HEADER_COUNTS + code] = running;
+        if (code < sigma) running += counts[code];
+    }
+    std::copy(huffman.begin(), huffman.end(), data + HEADER_WORDS);
+    for (std::size_t node = 0; node + 1 < sigma; node++) {
+        data[HEADER_WORDS + sigma + 2 * node] = nodeStart[node];
+        data[HEADER_WORDS + sigma + 2 * node + 1] =
+            children[2 * node] | (static_cast<std::uint64_t>(children[2 * node + 1]) << 32);
+    }
+
+    // 按行顺序把每个字符沿码字分发到途经结点的序列末尾
+    if (sigma > 1) {
+        std::vector<std::uint64_t> fill(nodeStart.begin(), nodeStart.end() - 1);
+        for (std::size_t row = 0; row < rows; row++) {
+            std::uint64_t code = huffman[bwt[row]];
+            std::size_t length = static_cast<std::size_t>(code & 0xff);
+            std::uint64_t path = code >> 8;
+            std::size_t node = 0;
+            for (std::size_t d = length; d-- > 0;) {
+                std::size_t side = (path >> d) & 1;
+                std::uint64_t pos = fill[node]++;
+                if (side) data[treeOffset + pos / 64] |= std::uint64_t(1) << (pos % 64);
+                std::uint32_t child = children[2 * node + side];
+                if (child & LEAF_FLAG) break;
+                node = child;
+            }
+        }
+    }
+    buildRankDirectory(data, treeOffset, static_cast<std::size_t>(treeBits));
+
+    // 采样：后缀起点是 sampleRate 整数倍的行打上标记，并按行顺序保存其起点
+    auto suffixAt = [&](std::size_t row) -> std::size_t { return row == 0 ? n : sa[row - 1]; };
+    std::size_t sampleIndex = 0;
+    for (std::size_t row = 0; row < rows; row++) {
+        std::size_t pos = suffixAt(row);
+        if (pos % sampleRate == 0) {
+            data[markOffset + row / 64] |= std::uint64_t(1) << (row % 64);
+            setPacked32(data + sampleOffset, sampleIndex++, static_cast<std::uint32_t>(pos));
+        }
+    }
+    buildRankDirectory(data, markOffset, rows);
+
+    attach(owned_.data(), owned_.size(), std::string());
+}
+
+void FMIndex::attach(const std::uint64_t* data, std::size_t wordCount, const std::string& path) {
+    auto invalid = [&path]() { return std::runtime_error("FM索引文件格式不正确: " + path); };
+    if (wordCount < HEADER_WORDS || data[HEADER_MAGIC] != FILE_MAGIC ||
+        data[HEADER_VERSION] != FILE_VERSION) {
+        throw invalid();
+    }
+
+    textLength_ = data[HEADER_LENGTH];
+    alphabetSize_ = data[HEADER_SIGMA];
+    sampleRate_ = data[HEADER_SAMPLE_RATE];
+    dollarRow_ = data[HEADER_DOLLAR_ROW];
+    sampleCount_ = data[HEADER_SAMPLE_COUNT];
+    std::uint64_t treeBits = data[HEADER_TREE_BITS];
+    if (textLength_ > SuffixArray::MAX_TEXT_LENGTH || alphabetSize_ > 256 || sampleRate_ == 0 ||
+        dollarRow_ > textLength_ || sampleCount_ != textLength_ / sampleRate_ + 1) {
+        throw invalid();
+    }
+    std::size_t sigma = static_cast<std::size_t>(alphabetSize_);
+    std::size_t rows = static_cast<std::size_t>(textLength_) + 1;
+    if (wordCount < HEADER_WORDS + treeWords(sigma)) throw invalid();
+
+    for (std::size_t c = 0; c < 256; c++) {
+        std::uint64_t code = data[HEADER_CODES + c];
+        if (code != NO_CODE && code >= alphabetSize_) throw invalid();
+        codeOf_[c] = code == NO_CODE ? std::int16_t(-1) : static_cast<std::int16_t>(code);
+    }
+
+    // C 从 1（终止符）开始严格递增到行数：每个编码至少出现一次，LF 映射不会越界
+    if (data[HEADER_COUNTS] != 1 || data[HEADER_COUNTS + sigma] != rows) throw invalid();
+    for (std::size_t code = 0; code < sigma; code++) {
+        if (data[HEADER_COUNTS + code] >= data[HEADER_COUNTS + code + 1]) throw invalid();
+    }
+
+    // 小波树：孩子编号必须大于父结点、叶子编码在范围内，每个编码的码字恰好走到
+    // 自己的叶子；由此推出各结点的序列长度，必须与结点表的区间和总位数一致
+    std::size_t nodeCount = sigma > 1 ? sigma - 1 : 0;
+    const std::uint64_t* table = data + HEADER_WORDS + sigma;
+    huffman_.assign(data + HEADER_WORDS, data + HEADER_WORDS + sigma);
+    nodes_.assign(nodeCount, TreeNode{});
+    for (std::size_t node = 0; node < nodeCount; node++) {
+        for (std::size_t side = 0; side < 2; side++) {
+            std::uint32_t child = static_cast<std::uint32_t>(table[2 * node + 1] >> (32 * side));
+            if ((child & LEAF_FLAG) ? (child & ~LEAF_FLAG) >= sigma : child <= node || child >= nodeCount) {
+                throw invalid();
+            }
+            nodes_[node].child[side] = child;
+        }
+    }
+    std::uint64_t expectedBits = 0;
+    for (std::size_t code = 0; code < sigma && nodeCount > 0; code++) {
+        std::uint64_t weight = data[HEADER_COUNTS + code + 1] - data[HEADER_COUNTS + code] + (code == 0 ? 1 : 0);
+        std::size_t length = static_cast<std::size_t>(huffman_[code] & 0xff);
+        std::uint64_t path = huffman_[code] >> 8;
+        if (length == 0 || length > MAX_CODE_LENGTH || (path >> length) != 0) throw invalid();
+        std::size_t node = 0;
+        for (std::size_t d = length; d-- > 0;) {
+            nodes_[node].length += static_cast<std::size_t>(weight);
+            std::uint32_t child = nodes_[node].child[(path >> d) & 1];
+            if ((child & LEAF_FLAG) != 0) {
+                if (d != 0 || child != (LEAF_FLAG | code)) throw invalid();
+                break;
+            }
+            if (d == 0) throw invalid();
+            node = child;
+        }
+        expectedBits += weight * length;
+    }
+    if (treeBits != expectedBits) throw invalid();
+    std::uint64_t start = 0;
+    for (std::size_t node = 0; node < nodeCount; node++) {
+        if (table[2 * node] != start || nodes_[node].length == 0) throw invalid();
+        nodes_[node].start = static_cast<std::size_t>(start);
+        start += nodes_[node].length;
+    }
+
+    std::size_t offset = HEADER_WORDS + treeWords(sigma);
+    std::size_t expected = offset + rankedWords(static_cast<std::size_t>(treeBits)) + rankedWords(rows) +
+                           static_cast<std::size_t>((sampleCount_ + 1) / 2);
+    if (wordCount != expected) throw invalid();
+
+    auto ranked = [&offset](std::size_t bits) {
+        RankedBits vector;
+        vector.bits = offset;
+        vector.superblocks = offset + bitWords(bits);
+        vector.blocks = vector.superblocks + superblockWords(bits);
+        offset += rankedWords(bits);
+        return vector;
+    };
+    tree_ = ranked(static_cast<std::size_t>(treeBits));
+    marks_ = ranked(rows);
+    samples_ = offset;
+
+    data_ = data;
+    wordCount_ = wordCount;
+    for (TreeNode& node : nodes_) node.onesBefore = rank1(tree_, node.start);
+}
+
+std::size_t FMIndex::rank1(const RankedBits& vector, std::size_t i) const noexcept {
+    std::size_t block = i / BLOCK_BITS;
+    std::size_t result = static_cast<std::size_t>(data_[vector.superblocks + i / SUPERBLOCK_BITS]) +
+                         getPacked16(data_ + vector.blocks, block);
+    for (std::size_t w = block * 8; w < i / 64; w++) {
+        result += detail::popcount64(data_[vector.bits + w]);
+    }
+    if (i % 64 != 0) {
+        std::uint64_t mask = (std::uint64_t(1) << (i % 64)) - 1;
+        result += detail::popcount64(data_[vector.bits + i / 64] & mask);
+    }
+    return result;
+}
+
+bool FMIndex::bit(std::size_t bitsOffset, std::size_t i) const noexcept {
+    return (data_[bitsOffset + i / 64] >> (i % 64)) & 1;
+}
+
+std::size_t FMIndex::nodeRank1(const TreeNode& node, std::size_t pos) const noexcept {
+    // rank 目录来自文件，结果钳制到 [0, pos]，损坏的文件也不会越界访问
+    std::size_t ones = rank1(tree_, node.start + pos);
+    ones = ones > node.onesBefore ? ones - node.onesBefore : 0;
+    return std::min(ones, pos);
+}
+
+std::size_t FMIndex::rank(std::size_t code, std::size_t i) const noexcept {
+    std::size_t start = 0;
+    std::size_t end = i;
+    if (!nodes_.empty()) {
+        std::size_t length = static_cast<std::size_t>(huffman_[code] & 0xff);
+        std::uint64_t path = huffman_[code] >> 8;
+        const TreeNode* node = &nodes_[0];
+        for (std::size_t d = length; d-- > 0;) {
+            std::size_t side = (path >> d) & 1;
+            std::size_t onesStart = nodeRank1(*node, start);
+            std::size_t onesEnd = nodeRank1(*node, end);
+            if (side) {
+                start = onesStart;
+                end = onesEnd;
+            } else {
+                start -= onesStart;
+                end -= onesEnd;
+            }
+            std::uint32_t child = node->child[side];
+            if (child & LEAF_FLAG) break;
+            node = &nodes_[child];
+            end = std::min(end, node->length);
+            start = std::min(start, end);
+        }
+    }
+    std::size_t result = end > start ? end - start : 0;
+    // 终止符以编码 0 占位，需要扣除
+    if (code == 0 && dollarRow_ < i && result > 0) result--;
+    std::size_t total = static_cast<std::size_t>(data_[HEADER_COUNTS + code + 1] - data_[HEADER_COUNTS + code]);
+    return std::min(result, total);
+}
+
+std::size_t FMIndex::accessCode(std::size_t row) const noexcept {
+    if (nodes_.empty()) return 0;
+    const TreeNode* node = &nodes_[0];
+    std::size_t pos = std::min(row, node->length - 1);
+    while (true) {
+        std::size_t side = bit(tree_.bits, node->start + pos) ? 1 : 0;
+        std::size_t ones = nodeRank1(*node, pos);
+        pos = side ? ones : pos - ones;
+        std::uint32_t child = node->child[side];
+        if (child & LEAF_FLAG) return child & ~LEAF_FLAG;
+        node = &nodes_[child];
+        pos = std::min(pos, node->length - 1);
+    }
+}
+
+std::size_t FMIndex::lastToFirst(std::size_t row) const noexcept {
+    std::size_t code = accessCode(row);
+    return static_cast<std::size_t>(data_[HEADER_COUNTS + code]) + rank(code, row);
+}
+
+std::size_t FMIndex::count(std::string_view pattern) const {
+    if (pattern.empty()) return 0;
+    std::size_t sp = 0;
+    std::size_t ep = static_cast<std::size_t>(textLength_) + 1;
+    for (std::size_t k = pattern.size(); k-- > 0;) {
+        int code = codeOf_[static_cast<unsigned char>(pattern[k])];
+        if (code < 0) return 0;
+        std::size_t base = static_cast<std::size_t>(data_[HEADER_COUNTS + code]);
+        sp = base + rank(code, sp);
+        ep = base + rank(code, ep);
+        if (sp >= ep) return 0;
+    }
+    return ep - sp;
+}
+
+std::vector<std::size_t> FMIndex::locate(std::string_view pattern) const {
+    std::vector<std::size_t> positions;
+    if (pattern.empty()) return positions;
+
+    std::size_t sp = 0;
+    std::size_t ep = static_cast<std::size_t>(textLength_) + 1;
+    for (std::size_t k = pattern.size(); k-- > 0;) {
+        int code = codeOf_[static_cast<unsigned char>(pattern[k])];
+        if (code < 0) return positions;
+        std::size_t base = static_cast<std::size_t>(data_[HEADER_COUNTS + code]);
+        sp = base + rank(code, sp);
+        ep = base + rank(code, ep);
+        if (sp >= ep) return positions;
+    }
+
+    std::size_t rows = static_cast<std::size_t>(textLength_) + 1;
+    positions.reserve(ep - sp);
+    for (std::size_t row = sp; row < ep; row++) {
+        // 沿 LF 映射回退到最近的采样行；终止符所在行的后缀起点为 0，总是被采样。
+        // 正确的索引最多回退 sampleRate - 1 步，超过说明采样标记已损坏
+        std::size_t current = row;
+        std::size_t steps = 0;
+        while (!bit(marks_.bits, current)) {
+            current = lastToFirst(current);
+            if (++steps >= sampleRate_ || current >= rows) {
+                throw std::runtime_error("FM索引数据已损坏");
+            }
+        }
+        std::size_t sample = std::min(rank1(marks_, current), static_cast<std::size_t>(sampleCount_ - 1));
+        positions.push_back(getPacked32(data_ + samples_, sample) + steps);
+    }
+    std::sort(positions.begin(), positions.end());
+    return positions;
+}
+
+void FMIndex::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("无法写入FM索引文件: " + path);
+    }
+    out.write(reinterpret_cast<const char*>(data_),
+              static_cast<std::streamsize>(wordCount_ * sizeof(std::uint64_t)));
+    if (!out) {
+        throw std::runtime_error("无法写入FM索引文件: " + path);
+    }
+}
+
+FMIndex FMIndex::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("无法打开FM索引文件: " + path);
+    }
+    std::streamoff bytes = in.tellg();
+    if (bytes < 0 || bytes % static_cast<std::streamoff>(sizeof(std::uint64_t)) != 0) {
+        throw std::runtime_error("FM索引文件格式不正确: " + path);
+    }
+    in.seekg(0);
+
+    FMIndex index;
+    index.owned_.resize(static_cast<std::size_t>(bytes) / sizeof(std::uint64_t));
+    in.read(reinterpret_cast<char*>(index.owned_.data()), bytes);
+    if (!in) {
+        throw std::runtime_error("无法读取FM索引文件: " + path);
+    }
+    index.attach(index.owned_.data(), index.owned_.size(), path);
+    return index;
+}
+
+FMIndex FMIndex::map(const std::string& path) {
+    FMIndex index;
+    index.mapping_ = std::make_unique<search::MappedFile>(path);
+    std::size_t bytes = index.mapping_->size();
+    if (bytes % sizeof(std::uint64_t) != 0) {
+        throw std::runtime_error("FM索引文件格式不正确: " + path);
+    }
+    // 映射地址按页对齐，可以直接按 64 位字访问
+    index.mapping_->advise(search::MappedFile::AccessPattern::Random);
+    index.attach(reinterpret_cast<const std::uint64_t*>(index.mapping_->data()),
+                 bytes / sizeof(std::uint64_t), path);
+    return index;
+}
+
+} // namespace algorithms
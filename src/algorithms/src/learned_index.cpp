@@ -0,0 +1,128 @@
+#include "algorithms/learned_index.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace algorithms {
+namespace search {
+
+PiecewiseLinearIndex::PiecewiseLinearIndex(const std::vector<int>& keys, int epsilon)
+    : keys_(&keys), segments_(), epsilon_(epsilon), maxError_(0) {
+    if (epsilon <= 0) {
+        throw std::invalid_argument("误差上界epsilon必须为正数");
+    }
+
+    std::size_t n = keys.size();
+    if (n == 0) return;
+
+    // 收缩锥算法：以段首点为锥顶，维护可行斜率区间 [slopeLow, slopeHigh]，
+    // 新点使区间为空时结束当前段。重复键只取首次出现的位置作为建模点。
+    const double inf = std::numeric_limits<double>::infinity();
+    const double eps = static_cast<double>(epsilon);
+    int x0 = keys[0];
+    std::size_t y0 = 0;
+    double slopeLow = -inf;
+    double slopeHigh = inf;
+
+    auto closeSegment = [&]() {
+        double slope = 0.0;
+        if (slopeHigh != inf) {
+            slope = (slopeLow + slopeHigh) / 2.0;
+        }
+        segments_.push_back({x0, slope, y0});
+    };
+
+    for (std::size_t i = 1; i < n; i++) {
+        if (keys[i] == keys[i - 1]) continue;
+
+        double dx = static_cast<double>(static_cast<long long>(keys[i]) - x0);
+        double dy = static_cast<double>(i) - static_cast<double>(y0);
+        double low = std::max(slopeLow, (dy - eps) / dx);
+        double high = std::min(slopeHigh, (dy + eps) / dx);
+
+        if (low > high) {
+            closeSegment();
+            x0 = keys[i];
+            y0 = i;
+            slopeLow = -inf;
+            slopeHigh = inf;
+        } else {
+            slopeLow = low;
+            slopeHigh = high;
+        }
+    }
+    closeSegment();
+    segments_.shrink_to_fit();
+
+    // 实测最大误差（浮点舍入可能使其与 epsilon 略有出入，查找窗口以实测值为准）
+    std::size_t seg = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        if (i > 0 && keys[i] == keys[i - 1]) continue;
+        while (seg + 1 < segments_.size() && segments_[seg + 1].startPos <= i) {
+            seg++;
+        }
+        std::size_t segEnd = seg + 1 < segments_.size() ? segments_[seg + 1].startPos : n;
+        std::size_t pred = predict(segments_[seg], segEnd, keys[i]);
+        std::size_t err = pred > i ? pred - i : i - pred;
+        maxError_ = std::max(maxError_, static_cast<int>(err));
+    }
+}
+
+std::size_t PiecewiseLinearIndex::predict(const Segment& seg, std::size_t segEnd, int target) const {
+    double offset = seg.slope * static_cast<double>(static_cast<long long>(target) - seg.firstKey);
+    double pos = static_cast<double>(seg.startPos) + std::round(offset);
+
+    // 预测值限制在段的位置范围内
+    if (pos < static_cast<double>(seg.startPos)) return seg.startPos;
+    if (pos > static_cast<double>(segEnd)) return segEnd;
+    return static_cast<std::size_t>(pos);
+}
+
+std::size_t PiecewiseLinearIndex::lowerBound(int target) const {
+    const std::vector<int>& keys = *keys_;
+    std::size_t n = keys.size();
+    if (n == 0 || target <= keys[0]) return 0;
+
+    // 定位最后一个 firstKey <= target 的线性段
+    auto it = std::upper_bound(segments_.begin(), segments_.end(), target,
+                               [](int value, const Segment& seg) { return value < seg.firstKey; });
+    std::size_t seg = static_cast<std::size_t>(it - segments_.begin()) - 1;
+    std::size_t segEnd = seg + 1 < segments_.size() ? segments_[seg + 1].startPos : n;
+    std::size_t pred = predict(segments_[seg], segEnd, target);
+
+    std::size_t err = static_cast<std::size_t>(maxError_);
+    std::size_t low = pred > err ? pred - err : 0;
+    std::size_t high = std::min(n, pred + err + 1);
+
+    // 窗口外兜底：查询值不是键时（尤其遇到大量重复键），答案可能落在窗口之外，
+    // 此时向外指数扩展直到满足 keys[low-1] < target <= keys[high]
+    std::size_t step = err + 1;
+    while (low > 0 && keys[low - 1] >= target) {
+        low = low > step ? low - step : 0;
+        step *= 2;
+    }
+    while (high < n && keys[high] < target) {
+        high = std::min(n, high + step);
+        step *= 2;
+    }
+
+    auto pos = std::lower_bound(keys.begin() + static_cast<std::ptrdiff_t>(low),
+                                keys.begin() + static_cast<std::ptrdiff_t>(high), target);
+    return static_cast<std::size_t>(pos - keys.begin());
+}
+
+int PiecewiseLinearIndex::find(int target) const {
+    std::size_t pos = lowerBound(target);
+    if (pos < keys_->size() && (*keys_)[pos] == target) {
+        return static_cast<int>(pos);
+    }
+    return -1; // 未找到
+}
+
+std::size_t PiecewiseLinearIndex::modelSizeBytes() const noexcept {
+    return sizeof(*this) + segments_.capacity() * sizeof(Segment);
+}
+
+} // namespace search
+} // namespace algorithms
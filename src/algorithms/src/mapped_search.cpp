@@ -0,0 +1,173 @@
+#include "algorithms/mapped_search.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace algorithms {
+namespace search {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path)
+    : data_(nullptr), size_(0), fileHandle_(INVALID_HANDLE_VALUE), mappingHandle_(nullptr) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("无法打开文件: " + path);
+    }
+    fileHandle_ = file;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        release();
+        throw std::runtime_error("无法获取文件大小: " + path);
+    }
+    size_ = static_cast<std::size_t>(fileSize.QuadPart);
+    if (size_ == 0) return;
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        release();
+        throw std::runtime_error("无法映射文件: " + path);
+    }
+    mappingHandle_ = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        release();
+        throw std::runtime_error("无法映射文件: " + path);
+    }
+    data_ = static_cast<const unsigned char*>(view);
+}
+
+void MappedFile::release() noexcept {
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+    }
+    if (mappingHandle_ != nullptr) {
+        CloseHandle(mappingHandle_);
+    }
+    if (fileHandle_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(fileHandle_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    mappingHandle_ = nullptr;
+    fileHandle_ = INVALID_HANDLE_VALUE;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_),
+      fileHandle_(other.fileHandle_), mappingHandle_(other.mappingHandle_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.fileHandle_ = INVALID_HANDLE_VALUE;
+    other.mappingHandle_ = nullptr;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = other.data_;
+        size_ = other.size_;
+        fileHandle_ = other.fileHandle_;
+        mappingHandle_ = other.mappingHandle_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.fileHandle_ = INVALID_HANDLE_VALUE;
+        other.mappingHandle_ = nullptr;
+    }
+    return *this;
+}
+
+void MappedFile::advise(AccessPattern) const noexcept {
+    // Windows 没有与 madvise 等价的预读策略接口，保持空操作
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) : data_(nullptr), size_(0), fd_(-1) {
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        throw std::runtime_error("无法打开文件: " + path);
+    }
+
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+        release();
+        throw std::runtime_error("无法获取文件大小: " + path);
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ == 0) return;
+
+    void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED) {
+        release();
+        throw std::runtime_error("无法映射文件: " + path);
+    }
+    data_ = static_cast<const unsigned char*>(addr);
+}
+
+void MappedFile::release() noexcept {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    fd_ = -1;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_), fd_(other.fd_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.fd_ = -1;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = other.data_;
+        size_ = other.size_;
+        fd_ = other.fd_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.fd_ = -1;
+    }
+    return *this;
+}
+
+void MappedFile::advise(AccessPattern pattern) const noexcept {
+    if (data_ == nullptr) return;
+
+    int advice = POSIX_MADV_NORMAL;
+    switch (pattern) {
+        case AccessPattern::Normal:     advice = POSIX_MADV_NORMAL; break;
+        case AccessPattern::Random:     advice = POSIX_MADV_RANDOM; break;
+        case AccessPattern::Sequential: advice = POSIX_MADV_SEQUENTIAL; break;
+        case AccessPattern::WillNeed:   advice = POSIX_MADV_WILLNEED; break;
+    }
+    // 提示失败不影响正确性，忽略返回值
+    (void)::posix_madvise(const_cast<unsigned char*>(data_), size_, advice);
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+} // namespace search
+} // namespace algorithms
@@ -0,0 +1,116 @@
+#include "algorithms/multi_array_search.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace algorithms {
+namespace search {
+
+MultiArraySearcher::MultiArraySearcher(std::vector<std::vector<int>> lists)
+    : lists_(std::move(lists)), levels_() {
+    for (const auto& list : lists_) {
+        if (!std::is_sorted(list.begin(), list.end())) {
+            throw std::invalid_argument("MultiArraySearcher要求所有数组已按升序排序");
+        }
+    }
+
+    levels_.resize(lists_.size());
+    for (std::size_t i = lists_.size(); i-- > 0;) {
+        rebuildLevel(i);
+    }
+}
+
+void MultiArraySearcher::rebuildLevel(std::size_t index) {
+    const std::vector<int>& own = lists_[index];
+    Level& level = levels_[index];
+    bool hasNext = index + 1 < levels_.size();
+
+    // 合并原数组与下一层增广数组中下标为奇数的元素
+    level.keys.clear();
+    if (hasNext) {
+        const std::vector<int>& nextKeys = levels_[index + 1].keys;
+        std::vector<int> sampled;
+        sampled.reserve(nextKeys.size() / 2);
+        for (std::size_t j = 1; j < nextKeys.size(); j += 2) {
+            sampled.push_back(nextKeys[j]);
+        }
+        level.keys.reserve(own.size() + sampled.size());
+        std::merge(own.begin(), own.end(), sampled.begin(), sampled.end(),
+                   std::back_inserter(level.keys));
+    } else {
+        level.keys = own;
+    }
+
+    // 单调指针扫描计算两类下界位置，末尾追加哨兵
+    std::size_t m = level.keys.size();
+    level.ownPos.assign(m + 1, own.size());
+    std::size_t ptr = 0;
+    for (std::size_t p = 0; p < m; p++) {
+        while (ptr < own.size() && own[ptr] < level.keys[p]) ptr++;
+        level.ownPos[p] = ptr;
+    }
+
+    level.nextPos.clear();
+    if (hasNext) {
+        const std::vector<int>& nextKeys = levels_[index + 1].keys;
+        level.nextPos.assign(m + 1, nextKeys.size());
+        ptr = 0;
+        for (std::size_t p = 0; p < m; p++) {
+            while (ptr < nextKeys.size() && nextKeys[ptr] < level.keys[p]) ptr++;
+            level.nextPos[p] = ptr;
+        }
+    }
+}
+
+std::vector<std::size_t> MultiArraySearcher::lowerBounds(int target) const {
+    std::vector<std::size_t> result;
+    lowerBounds(target, result);
+    return result;
+}
+
+void MultiArraySearcher::lowerBounds(int target, std::vector<std::size_t>& result) const {
+    result.resize(levels_.size());
+    if (levels_.empty()) return;
+
+    const std::vector<int>& firstKeys = levels_[0].keys;
+    std::size_t p = static_cast<std::size_t>(
+        std::lower_bound(firstKeys.begin(), firstKeys.end(), target) - firstKeys.begin());
+    result[0] = levels_[0].ownPos[p];
+
+    for (std::size_t i = 1; i < levels_.size(); i++) {
+        // 桥指针给出的位置至多比真实下界靠后一个元素
+        std::size_t q = levels_[i - 1].nextPos[p];
+        const std::vector<int>& keys = levels_[i].keys;
+        while (q > 0 && keys[q - 1] >= target) {
+            q--;
+        }
+        p = q;
+        result[i] = levels_[i].ownPos[p];
+    }
+}
+
+void MultiArraySearcher::updateList(std::size_t index, std::vector<int> list) {
+    if (index >= lists_.size()) {
+        throw std::out_of_range("MultiArraySearcher数组下标越界");
+    }
+    if (!std::is_sorted(list.begin(), list.end())) {
+        throw std::invalid_argument("MultiArraySearcher要求所有数组已按升序排序");
+    }
+
+    lists_[index] = std::move(list);
+    for (std::size_t i = index + 1; i-- > 0;) {
+        rebuildLevel(i);
+    }
+}
+
+std::size_t MultiArraySearcher::augmentedSize() const noexcept {
+    std::size_t total = 0;
+    for (const auto& level : levels_) {
+        total += level.keys.size();
+    }
+    return total;
+}
+
+} // namespace search
+} // namespace algorithms
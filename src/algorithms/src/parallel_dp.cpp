@@ -0,0 +1,142 @@
+#include "algorithms/parallel_dp.h"
+#include "algorithms/dp_algorithms.h"
+#include "algorithms/detail/bit_parallel_lcs.h"
+#include "algorithms/detail/parallel_chunks.h"
+#include "algorithms/detail/wavefront.h"
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace algorithms {
+
+namespace {
+
+// LCS 分块：1024 行 x 64 个字（4096 列）
+constexpr std::size_t LCS_TILE_ROWS = 1024;
+constexpr std::size_t LCS_TILE_WORDS = 64;
+
+// 编辑距离分块：4 个字（256 行）x 2048 列
+constexpr std::size_t EDIT_TILE_WORDS = 4;
+constexpr std::size_t EDIT_TILE_COLS = 2048;
+
+std::size_t tileCount(std::size_t length, std::size_t tile) {
+    return (length + tile - 1) / tile;
+}
+
+unsigned resolveDpThreads(std::size_t m, std::size_t n, unsigned threads, std::size_t tileRows) {
+    unsigned resolved = detail::resolveThreadCount(m * n, threads, PARALLEL_DP_MIN_CELLS);
+    return static_cast<unsigned>(std::min<std::size_t>(resolved, tileRows));
+}
+
+// Hyyrö 分块位向量编辑距离的单字更新：pv/mv 为该字 64 行的纵向差值 +1/-1，
+// hin 为从上一个字传入的横向差值，返回第 top 位所在行向下传出的横向差值
+inline int editStep(std::uint64_t& pv, std::uint64_t& mv, std::uint64_t eq, int hin, unsigned top) noexcept {
+    std::uint64_t hinNegative = hin < 0 ? 1 : 0;
+    std::uint64_t hinPositive = hin > 0 ? 1 : 0;
+    std::uint64_t xv = eq | mv;
+    eq |= hinNegative;
+    std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    std::uint64_t ph = mv | ~(xh | pv);
+    std::uint64_t mh = pv & xh;
+    int hout = static_cast<int>((ph >> top) & 1) - static_cast<int>((mh >> top) & 1);
+    ph = (ph << 1) | hinPositive;
+    mh = (mh << 1) | hinNegative;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+    return hout;
+}
+
+} // namespace
+
+int parallelLongestCommonSubsequence(const std::string& s1, const std::string& s2, unsigned threads) {
+    if (s1.empty() || s2.empty()) return 0;
+
+    const std::string& rows = s1.size() >= s2.size() ? s1 : s2;
+    const std::string& columns = s1.size() >= s2.size() ? s2 : s1;
+    std::size_t tileRows = tileCount(rows.size(), LCS_TILE_ROWS);
+    unsigned resolved = resolveDpThreads(rows.size(), columns.size(), threads, tileRows);
+    if (resolved == 1) return longestCommonSubsequence(s1, s2);
+
+    detail::BitParallelLcs engine(columns);
+    std::vector<std::uint64_t> state(engine.words(), ~std::uint64_t(0));
+    std::vector<std::uint8_t> carries(rows.size(), 0);
+    std::size_t tileCols = tileCount(engine.words(), LCS_TILE_WORDS);
+
+    // 分块 (r, c) 更新第 c 列块的状态字；同一列块按行块顺序更新，
+    // 同一行块的进位按列块顺序传递
+    auto tile = [&](std::size_t r, std::size_t c) {
+        std::size_t rowBegin = r * LCS_TILE_ROWS;
+        std::size_t rowCount = std::min(LCS_TILE_ROWS, rows.size() - rowBegin);
+        std::size_t wordBegin = c * LCS_TILE_WORDS;
+        std::size_t wordEnd = std::min(wordBegin + LCS_TILE_WORDS, engine.words());
+        engine.advanceWords(state.data(), wordBegin, wordEnd,
+                            std::string_view(rows).substr(rowBegin, rowCount), &carries[rowBegin]);
+    };
+    detail::runWavefront(tileRows, tileCols, resolved, tile);
+    return static_cast<int>(engine.lengthFromState(state.data()));
+}
+
+int parallelEditDistance(const std::string& s1, const std::string& s2, unsigned threads) {
+    if (s1.empty() || s2.empty()) return static_cast<int>(std::max(s1.size(), s2.size()));
+
+    // 较长的字符串按位排成行，行块多，可分给更多线程
+    const std::string& rows = s1.size() >= s2.size() ? s1 : s2;
+    const std::string& columns = s1.size() >= s2.size() ? s2 : s1;
+    std::size_t m = rows.size();
+    std::size_t n = columns.size();
+    std::size_t words = (m + 63) / 64;
+    std::size_t tileRows = tileCount(words, EDIT_TILE_WORDS);
+    std::size_t tileCols = tileCount(n, EDIT_TILE_COLS);
+    unsigned resolved = resolveDpThreads(m, n, threads, tileRows);
+
+    // masks[slot * words + k]：第 k 个字中等于该字符的行
+    std::int32_t slot[256];
+    std::fill(slot, slot + 256, -1);
+    std::size_t alphabet = 0;
+    for (char ch : rows) {
+        std::int32_t& id = slot[static_cast<unsigned char>(ch)];
+        if (id < 0) id = static_cast<std::int32_t>(alphabet++);
+    }
+    std::vector<std::uint64_t> masks(alphabet * words, 0);
+    for (std::size_t i = 0; i < m; i++) {
+        masks[static_cast<std::size_t>(slot[static_cast<unsigned char>(rows[i])]) * words + i / 64] |=
+            std::uint64_t(1) << (i % 64);
+    }
+
+    // pv/mv：各字的纵向差值，初值对应第 0 列 dp[i][0] = i；
+    // horizontal[j]：第 j 列在最近一个行块底部的横向差值，初值对应第 0 行 dp[0][j] = j
+    std::vector<std::uint64_t> pv(words, ~std::uint64_t(0));
+    std::vector<std::uint64_t> mv(words, 0);
+    std::vector<std::int8_t> horizontal(n, 1);
+    const unsigned lastTop = static_cast<unsigned>((m - 1) % 64);
+
+    // 分块 (r, c) 用第 r 个行块的位向量读入第 c 个列块的字符；横向差值在行块之间
+    // 逐列向下传递，纵向位向量在同一行块的列块之间按顺序传递
+    auto tile = [&](std::size_t r, std::size_t c) {
+        std::size_t wordBegin = r * EDIT_TILE_WORDS;
+        std::size_t wordEnd = std::min(wordBegin + EDIT_TILE_WORDS, words);
+        std::size_t colBegin = c * EDIT_TILE_COLS;
+        std::size_t colEnd = std::min(colBegin + EDIT_TILE_COLS, n);
+
+        for (std::size_t k = wordBegin; k < wordEnd; k++) {
+            std::uint64_t p = pv[k], q = mv[k];
+            unsigned top = k + 1 == words ? lastTop : 63;
+            for (std::size_t j = colBegin; j < colEnd; j++) {
+                std::int32_t id = slot[static_cast<unsigned char>(columns[j])];
+                std::uint64_t eq = id < 0 ? 0 : masks[static_cast<std::size_t>(id) * words + k];
+                horizontal[j] = static_cast<std::int8_t>(editStep(p, q, eq, horizontal[j], top));
+            }
+            pv[k] = p;
+            mv[k] = q;
+        }
+    };
+    detail::runWavefront(tileRows, tileCols, resolved, tile);
+
+    // dp[m][n] = dp[m][0] + 最后一行的横向差值之和
+    long long distance = static_cast<long long>(m);
+    for (std::int8_t delta : horizontal) distance += delta;
+    return static_cast<int>(distance);
+}
+
+} // namespace algorithms
@@ -0,0 +1,59 @@
+#include "algorithms/parallel_search.h"
+#include "algorithms/detail/parallel_chunks.h"
+#include "algorithms/string_algorithms.h"
+#include <iterator>
+
+namespace algorithms {
+
+// 第 t 块负责起始位置 [begin, end)，扫描区域向后延伸 m-1 个字节，
+// 因此每个匹配只属于其起点所在的块。
+
+std::size_t parallelCountMatches(std::string_view text, std::string_view pattern, unsigned threads) {
+    std::size_t m = pattern.size();
+    if (m == 0 || text.size() < m) return 0;
+
+    std::size_t starts = text.size() - m + 1;
+    unsigned chunks = detail::resolveThreadCount(starts, threads, PARALLEL_SEARCH_MIN_CHUNK);
+    if (chunks == 1) return countMatches(text, pattern);
+
+    std::vector<std::size_t> counts(chunks, 0);
+    auto work = [&](unsigned t, std::size_t begin, std::size_t end) {
+        counts[t] = countMatches(text.substr(begin, end - begin + m - 1), pattern);
+    };
+    detail::runChunks(starts, chunks, work);
+
+    std::size_t total = 0;
+    for (std::size_t c : counts) total += c;
+    return total;
+}
+
+std::vector<std::size_t> parallelFindAll(std::string_view text, std::string_view pattern, unsigned threads) {
+    std::vector<std::size_t> result;
+    std::size_t m = pattern.size();
+    if (m == 0 || text.size() < m) return result;
+
+    std::size_t starts = text.size() - m + 1;
+    unsigned chunks = detail::resolveThreadCount(starts, threads, PARALLEL_SEARCH_MIN_CHUNK);
+    if (chunks == 1) {
+        findMatches(text, pattern, std::back_inserter(result));
+        return result;
+    }
+
+    // 每个块的匹配位置换算成相对整个文本的绝对位置
+    std::vector<std::vector<std::size_t>> partial(chunks);
+    auto work = [&](unsigned t, std::size_t begin, std::size_t end) {
+        forEachMatch(text.substr(begin, end - begin + m - 1), pattern,
+                     [&](std::size_t pos) { partial[t].push_back(begin + pos); });
+    };
+    detail::runChunks(starts, chunks, work);
+
+    std::size_t total = 0;
+    for (const auto& part : partial) total += part.size();
+    result.reserve(total);
+    for (const auto& part : partial) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
+}
+
+} // namespace algorithms
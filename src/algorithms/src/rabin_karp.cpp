@@ -0,0 +1,164 @@
+#include "algorithms/rabin_karp.h"
+#include "algorithms/detail/parallel_chunks.h"
+#include "algorithms/parallel_search.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace algorithms {
+
+namespace {
+
+unsigned ceilLog2(std::size_t x) {
+    unsigned bits = 0;
+    while ((std::size_t(1) << bits) < x) bits++;
+    return bits;
+}
+
+bool matchLess(const PatternMatch& a, const PatternMatch& b) {
+    if (a.position != b.position) return a.position < b.position;
+    return a.patternId < b.patternId;
+}
+
+} // namespace
+
+RabinKarpMatcher::RabinKarpMatcher(const std::vector<std::string>& patterns)
+    : groups_(), entryHash_(), entryId_(), table_(), filter_(), patternData_(), patternOffsets_() {
+    if (patterns.size() >= EMPTY_SLOT) {
+        throw std::invalid_argument("RabinKarpMatcher模式数量过多");
+    }
+
+    std::size_t totalLength = 0;
+    for (const auto& pattern : patterns) totalLength += pattern.size();
+    patternData_.reserve(totalLength);
+    patternOffsets_.reserve(patterns.size());
+    for (const auto& pattern : patterns) {
+        patternOffsets_.emplace_back(patternData_.size(), pattern.size());
+        patternData_ += pattern;
+    }
+
+    auto fingerprint = [&](std::size_t id) {
+        std::uint64_t h = 0;
+        const std::string& pattern = patterns[id];
+        for (char ch : pattern) h = h * BASE + static_cast<unsigned char>(ch);
+        return h;
+    };
+
+    // 非空模式按（长度、指纹、编号）排序，同一长度连续，同一指纹连续
+    std::vector<std::uint32_t> order;
+    std::vector<std::uint64_t> hashes(patterns.size());
+    for (std::size_t id = 0; id < patterns.size(); id++) {
+        if (patterns[id].empty()) continue;
+        hashes[id] = fingerprint(id);
+        order.push_back(static_cast<std::uint32_t>(id));
+    }
+    std::sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+        if (patterns[a].size() != patterns[b].size()) return patterns[a].size() < patterns[b].size();
+        if (hashes[a] != hashes[b]) return hashes[a] < hashes[b];
+        return a < b;
+    });
+    entryId_ = order;
+    entryHash_.reserve(order.size());
+    for (std::uint32_t id : order) entryHash_.push_back(hashes[id]);
+
+    for (std::size_t first = 0; first < order.size();) {
+        std::size_t length = patterns[order[first]].size();
+        std::size_t last = first;
+        std::size_t distinct = 0;
+        for (; last < order.size() && patterns[order[last]].size() == length; last++) {
+            if (last == first || entryHash_[last] != entryHash_[last - 1]) distinct++;
+        }
+
+        Group group;
+        group.length = length;
+        group.power = 1;
+        for (std::size_t i = 1; i < length; i++) group.power *= BASE;
+        // 装载因子不超过 1/2；过滤器每个指纹约 16 位
+        group.tableBits = std::max(4u, ceilLog2(distinct * 2));
+        group.filterBits = std::max(9u, ceilLog2(distinct * 16));
+        group.tableOffset = table_.size();
+        group.filterOffset = filter_.size();
+        table_.resize(table_.size() + (std::size_t(1) << group.tableBits), EMPTY_SLOT);
+        filter_.resize(filter_.size() + (std::size_t(1) << (group.filterBits - 6)), 0);
+
+        std::uint32_t* table = table_.data() + group.tableOffset;
+        std::uint64_t* filter = filter_.data() + group.filterOffset;
+        std::size_t tableMask = (std::size_t(1) << group.tableBits) - 1;
+        for (std::size_t e = first; e < last; e++) {
+            if (e != first && entryHash_[e] == entryHash_[e - 1]) continue;
+            std::uint64_t mixed = mix(entryHash_[e]);
+            std::uint64_t bit = mixed >> (64 - group.filterBits);
+            filter[bit >> 6] |= std::uint64_t(1) << (bit & 63);
+            std::size_t slot = static_cast<std::size_t>(mixed * 0x94d049bb133111ebULL >> (64 - group.tableBits));
+            while (table[slot] != EMPTY_SLOT) slot = (slot + 1) & tableMask;
+            table[slot] = static_cast<std::uint32_t>(e);
+        }
+
+        groups_.push_back(group);
+        first = last;
+    }
+}
+
+std::vector<PatternMatch> RabinKarpMatcher::findAll(std::string_view text) const {
+    std::vector<PatternMatch> matches;
+    forEachMatch(text, [&matches](std::size_t id, std::size_t pos) { matches.push_back({id, pos}); });
+    std::sort(matches.begin(), matches.end(), matchLess);
+    return matches;
+}
+
+std::size_t RabinKarpMatcher::count(std::string_view text) const {
+    std::size_t total = 0;
+    forEachMatch(text, [&total](std::size_t, std::size_t) { total++; });
+    return total;
+}
+
+std::vector<PatternMatch> RabinKarpMatcher::findAllParallel(std::string_view text, unsigned threads) const {
+    std::size_t n = text.size();
+    unsigned chunks = detail::resolveThreadCount(n, threads, PARALLEL_SEARCH_MIN_CHUNK);
+    if (chunks == 1 || groups_.empty()) return findAll(text);
+
+    std::vector<std::vector<PatternMatch>> partial(chunks);
+    auto work = [&](unsigned t, std::size_t begin, std::size_t end) {
+        auto collect = [&partial, t](std::size_t id, std::size_t pos) { partial[t].push_back({id, pos}); };
+        scan(text, begin, end, collect);
+        std::sort(partial[t].begin(), partial[t].end(), matchLess);
+    };
+    detail::runChunks(n, chunks, work);
+
+    // 各块的起始位置互不重叠，按块顺序拼接即整体有序
+    std::vector<PatternMatch> matches;
+    std::size_t total = 0;
+    for (const auto& part : partial) total += part.size();
+    matches.reserve(total);
+    for (const auto& part : partial) {
+        matches.insert(matches.end(), part.begin(), part.end());
+    }
+    return matches;
+}
+
+std::size_t RabinKarpMatcher::countParallel(std::string_view text, unsigned threads) const {
+    std::size_t n = text.size();
+    unsigned chunks = detail::resolveThreadCount(n, threads, PARALLEL_SEARCH_MIN_CHUNK);
+    if (chunks == 1 || groups_.empty()) return count(text);
+
+    std::vector<std::size_t> counts(chunks, 0);
+    auto work = [&](unsigned t, std::size_t begin, std::size_t end) {
+        auto tally = [&counts, t](std::size_t, std::size_t) { counts[t]++; };
+        scan(text, begin, end, tally);
+    };
+    detail::runChunks(n, chunks, work);
+    return std::accumulate(counts.begin(), counts.end(), std::size_t(0));
+}
+
+std::size_t RabinKarpMatcher::memoryBytes() const noexcept {
+    return sizeof(*this) +
+           groups_.capacity() * sizeof(Group) +
+           entryHash_.capacity() * sizeof(std::uint64_t) +
+           entryId_.capacity() * sizeof(std::uint32_t) +
+           table_.capacity() * sizeof(std::uint32_t) +
+           filter_.capacity() * sizeof(std::uint64_t) +
+           patternData_.capacity() +
+           patternOffsets_.capacity() * sizeof(std::pair<std::size_t, std::size_t>);
+}
+
+} // namespace algorithms
@@ -1,4 +1,6 @@
 #include "algorithms/search.h"
+#include <algorithm>
+#include <cmath>
 
 namespace algorithms {
 namespace search {
@@ -47,13 +49,8 @@ int interpolationSearch(const std::vector<int>& arr, int target) {
         // 计算插值位置（使用long long避免溢出）
         int denominator = arr[high] - arr[low];
         if (denominator == 0) {
-            // 当所有元素相等时，回退到线性查找
-            for (int i = low; i <= high; i++) {
-                if (arr[i] == target) {
-                    return i;
-                }
-            }
-            return -1;
+            // 区间内所有元素相等，无需逐个比较
+            return arr[low] == target ? low : -1;
         }
         
         // 使用long long进行中间计算，避免整数溢出
@@ -75,6 +72,68 @@ int interpolationSearch(const std::vector<int>& arr, int target) {
     return -1; // 未找到
 }
 
+int adaptiveInterpolationSearch(const std::vector<int>& arr, int target) {
+    int n = static_cast<int>(arr.size());
+    if (n == 0) return -1;
+
+    int low = 0;
+    int high = n - 1;
+    bool bisect = false;
+
+    while (!bisect && low <= high && target >= arr[low] && target <= arr[high]) {
+        if (arr[high] == arr[low]) {
+            // 区间内所有元素相等
+            return arr[low] == target ? low : -1;
+        }
+
+        int width = high - low;
+        long long numerator = (static_cast<long long>(target) - arr[low]) * width;
+        int pos = low + static_cast<int>(numerator / (static_cast<long long>(arr[high]) - arr[low]));
+        if (pos < low) pos = low;
+        if (pos > high) pos = high;
+        if (arr[pos] == target) return pos;
+
+        // 插值误差约为 sqrt(区间宽度)：在目标一侧相距 guard 处再探测一次，
+        // 命中时区间直接收缩到 guard 以内
+        int guard = static_cast<int>(std::sqrt(static_cast<double>(width))) + 1;
+        if (arr[pos] < target) {
+            low = pos + 1;
+            int probe = std::min(high, pos + guard);
+            if (arr[probe] == target) return probe;
+            if (arr[probe] > target) {
+                high = probe - 1;
+            } else {
+                low = probe + 1;
+            }
+        } else {
+            high = pos - 1;
+            int probe = std::max(low, pos - guard);
+            if (arr[probe] == target) return probe;
+            if (arr[probe] < target) {
+                low = probe + 1;
+            } else {
+                high = probe - 1;
+            }
+        }
+
+        // 一轮插值约三次访存，至少要抵上三次二分（区间缩小到 1/8），
+        // 否则说明分布偏斜，剩余区间改用二分
+        bisect = (high - low) > width / 8;
+    }
+
+    // 二分阶段不再读取区间端点，每次迭代只访问一次中点
+    while (bisect && low <= high) {
+        int mid = low + (high - low) / 2;
+        if (arr[mid] == target) return mid;
+        if (arr[mid] < target) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return -1; // 未找到
+}
+
 int fibonacciSearch(const std::vector<int>& arr, int target) {
     int n = static_cast<int>(arr.size());
     if (n == 0) return -1;
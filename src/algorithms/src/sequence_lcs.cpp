@@ -0,0 +1,101 @@
+#include "algorithms/sequence_lcs.h"
+#include "algorithms/detail/bit_parallel_lcs.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace algorithms {
+
+namespace {
+
+void validateIds(const std::vector<std::uint32_t>& seq, std::size_t alphabetSize) {
+    for (std::uint32_t id : seq) {
+        if (id >= alphabetSize) {
+            throw std::invalid_argument("序列中的编号必须小于字母表大小");
+        }
+    }
+}
+
+// Hunt-Szymanski：按 a 的顺序处理所有匹配对 (i, j)，thresh[k] 为长度 k+1 的公共子序列
+// 在 b 中可能的最小结尾位置；同一个 i 的匹配位置从大到小处理，避免一行用两次
+std::size_t huntSzymanski(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b,
+                          std::size_t alphabetSize) {
+    // b 中每个编号出现位置的 CSR 列表（升序）
+    std::vector<std::size_t> start(alphabetSize + 1, 0);
+    for (std::uint32_t id : b) start[id + 1]++;
+    for (std::size_t c = 0; c < alphabetSize; c++) start[c + 1] += start[c];
+    std::vector<std::size_t> positions(b.size());
+    std::vector<std::size_t> fill(start.begin(), start.end() - 1);
+    for (std::size_t j = 0; j < b.size(); j++) positions[fill[b[j]]++] = j;
+
+    std::vector<std::size_t> thresh;
+    for (std::uint32_t id : a) {
+        for (std::size_t p = start[id + 1]; p-- > start[id];) {
+            std::size_t j = positions[p];
+            auto it = std::lower_bound(thresh.begin(), thresh.end(), j);
+            if (it == thresh.end()) {
+                thresh.push_back(j);
+            } else {
+                *it = j;
+            }
+        }
+    }
+    return thresh.size();
+}
+
+std::size_t bitParallel(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b,
+                        std::size_t alphabetSize) {
+    // 较短的序列作为位向量的列
+    const std::vector<std::uint32_t>& rows = a.size() >= b.size() ? a : b;
+    const std::vector<std::uint32_t>& columns = a.size() >= b.size() ? b : a;
+    detail::BitParallelLcs engine(columns.data(), columns.size(), alphabetSize);
+    return engine.length(rows.data(), rows.size());
+}
+
+} // namespace
+
+LcsEngine selectLcsEngine(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b,
+                          std::size_t alphabetSize) {
+    validateIds(a, alphabetSize);
+    validateIds(b, alphabetSize);
+    if (a.empty() || b.empty()) return LcsEngine::BitParallel;
+
+    std::size_t longer = std::max(a.size(), b.size());
+    std::size_t shorter = std::min(a.size(), b.size());
+
+    // 匹配对数 r = Σ countA[c] * countB[c]，以及列序列（较短者）中的不同符号数
+    std::vector<std::uint32_t> countA(alphabetSize, 0), countB(alphabetSize, 0);
+    for (std::uint32_t id : a) countA[id]++;
+    for (std::uint32_t id : b) countB[id]++;
+    const std::vector<std::uint32_t>& columnCounts = a.size() >= b.size() ? countB : countA;
+    double pairs = 0;
+    std::size_t distinctColumns = 0;
+    for (std::size_t c = 0; c < alphabetSize; c++) {
+        pairs += static_cast<double>(countA[c]) * static_cast<double>(countB[c]);
+        if (columnCounts[c] != 0) distinctColumns++;
+    }
+
+    double words = static_cast<double>((shorter + 63) / 64);
+    if (static_cast<double>(distinctColumns) * words > static_cast<double>(LCS_MAX_MASK_WORDS)) {
+        return LcsEngine::HuntSzymanski;
+    }
+    double bitParallelCost = static_cast<double>(longer) * words;
+    double huntSzymanskiCost = (pairs + static_cast<double>(a.size())) * std::log2(static_cast<double>(b.size()) + 2);
+    return huntSzymanskiCost < bitParallelCost ? LcsEngine::HuntSzymanski : LcsEngine::BitParallel;
+}
+
+std::size_t lcsLength(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b,
+                      std::size_t alphabetSize, LcsEngine engine) {
+    if (engine == LcsEngine::Auto) {
+        engine = selectLcsEngine(a, b, alphabetSize);  // 同时完成编号校验
+    } else {
+        validateIds(a, alphabetSize);
+        validateIds(b, alphabetSize);
+    }
+    if (a.empty() || b.empty()) return 0;
+
+    if (engine == LcsEngine::HuntSzymanski) return huntSzymanski(a, b, alphabetSize);
+    return bitParallel(a, b, alphabetSize);
+}
+
+} // namespace algorithms
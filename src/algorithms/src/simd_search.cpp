@@ -0,0 +1,149 @@
+#include "algorithms/detail/simd_search.h"
+#include <cstdint>
+#include <cstring>
+
+#if ALGORITHMS_ARCH_X86
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace algorithms {
+namespace detail {
+
+namespace {
+
+inline unsigned countTrailingZeros(std::uint64_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<unsigned>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+    unsigned n = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+// 逐个校验候选位掩码，bit i 对应起点 base + i
+inline bool verifyCandidates(std::uint64_t mask, const char* text, std::size_t base,
+                             const char* pattern, std::size_t m,
+                             MatchCallback onMatch, void* context) {
+    while (mask != 0) {
+        std::size_t pos = base + countTrailingZeros(mask);
+        if (m <= 2 || std::memcmp(text + pos + 1, pattern + 1, m - 2) == 0) {
+            if (!onMatch(context, pos)) return false;
+        }
+        mask &= mask - 1;
+    }
+    return true;
+}
+
+// 标量版本：用 memchr 定位首字节，再校验其余部分；也用于处理向量循环的尾部
+bool scanScalar(const char* text, std::size_t n, std::size_t from, const char* pattern,
+                std::size_t m, MatchCallback onMatch, void* context) {
+    if (n < m) return true;
+    std::size_t lastStart = n - m;
+    std::size_t i = from;
+    while (i <= lastStart) {
+        const void* hit = std::memchr(text + i, pattern[0], lastStart - i + 1);
+        if (hit == nullptr) break;
+        i = static_cast<std::size_t>(static_cast<const char*>(hit) - text);
+        if (text[i + m - 1] == pattern[m - 1] &&
+            std::memcmp(text + i + 1, pattern + 1, m > 1 ? m - 1 : 0) == 0) {
+            if (!onMatch(context, i)) return false;
+        }
+        i++;
+    }
+    return true;
+}
+
+#if ALGORITHMS_ARCH_X86 && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ALGORITHMS_HAS_SSE2_BASELINE 1
+
+void scanSse2(const char* text, std::size_t n, const char* pattern, std::size_t m,
+              MatchCallback onMatch, void* context) {
+    const __m128i first = _mm_set1_epi8(pattern[0]);
+    const __m128i last = _mm_set1_epi8(pattern[m - 1]);
+    std::size_t i = 0;
+    for (; i + m - 1 + 16 <= n; i += 16) {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + m - 1));
+        __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast));
+        auto mask = static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(eq)));
+        if (!verifyCandidates(mask, text, i, pattern, m, onMatch, context)) return;
+    }
+    scanScalar(text, n, i, pattern, m, onMatch, context);
+}
+
+ALGORITHMS_TARGET_AVX2
+void scanAvx2(const char* text, std::size_t n, const char* pattern, std::size_t m,
+              MatchCallback onMatch, void* context) {
+    const __m256i first = _mm256_set1_epi8(pattern[0]);
+    const __m256i last = _mm256_set1_epi8(pattern[m - 1]);
+    std::size_t i = 0;
+    for (; i + m - 1 + 32 <= n; i += 32) {
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i + m - 1));
+        __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst),
+                                      _mm256_cmpeq_epi8(last, blockLast));
+        auto mask = static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(eq)));
+        if (!verifyCandidates(mask, text, i, pattern, m, onMatch, context)) return;
+    }
+    scanScalar(text, n, i, pattern, m, onMatch, context);
+}
+
+ALGORITHMS_TARGET_AVX512BW
+void scanAvx512(const char* text, std::size_t n, const char* pattern, std::size_t m,
+                MatchCallback onMatch, void* context) {
+    const __m512i first = _mm512_set1_epi8(pattern[0]);
+    const __m512i last = _mm512_set1_epi8(pattern[m - 1]);
+    std::size_t i = 0;
+    for (; i + m - 1 + 64 <= n; i += 64) {
+        __m512i blockFirst = _mm512_loadu_si512(text + i);
+        __m512i blockLast = _mm512_loadu_si512(text + i + m - 1);
+        std::uint64_t mask = _mm512_cmpeq_epi8_mask(first, blockFirst) &
+                             _mm512_cmpeq_epi8_mask(last, blockLast);
+        if (!verifyCandidates(mask, text, i, pattern, m, onMatch, context)) return;
+    }
+    scanScalar(text, n, i, pattern, m, onMatch, context);
+}
+
+#endif
+
+} // namespace
+
+void simdScan(const char* text, std::size_t n, const char* pattern, std::size_t m,
+              SimdLevel level, MatchCallback onMatch, void* context) {
+    if (m == 0 || n < m) return;
+
+#ifdef ALGORITHMS_HAS_SSE2_BASELINE
+    switch (clampSimdLevel(level)) {
+        case SimdLevel::AVX512:
+            scanAvx512(text, n, pattern, m, onMatch, context);
+            return;
+        case SimdLevel::AVX2:
+            scanAvx2(text, n, pattern, m, onMatch, context);
+            return;
+        case SimdLevel::SSE2:
+            scanSse2(text, n, pattern, m, onMatch, context);
+            return;
+        case SimdLevel::Scalar:
+        default:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    scanScalar(text, n, 0, pattern, m, onMatch, context);
+}
+
+} // namespace detail
+} // namespace algorithms
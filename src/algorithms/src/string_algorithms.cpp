@@ -1,4 +1,7 @@
 #include "algorithms/string_algorithms.h"
+#include "algorithms/detail/simd_search.h"
+#include <algorithm>
+#include <utility>
 
 namespace algorithms {
 
@@ -60,4 +63,310 @@ std::vector<int> kmpSearch(const std::string& text, const std::string& pattern)
     return result;
 }
 
+namespace {
+
+// Horspool 坏字符跳转表：窗口末字节为 c 时窗口可右移的距离
+void buildHorspoolSkip(std::string_view pattern, std::size_t (&skip)[256]) {
+    std::size_t m = pattern.size();
+    for (std::size_t& s : skip) {
+        s = m;
+    }
+    for (std::size_t j = 0; j + 1 < m; j++) {
+        skip[static_cast<unsigned char>(pattern[j])] = m - 1 - j;
+    }
+}
+
+} // namespace
+
+std::vector<int> horspoolSearch(const std::string& text, const std::string& pattern) {
+    std::vector<int> result;
+    std::size_t n = text.size();
+    std::size_t m = pattern.size();
+    if (m == 0 || n < m) return result;
+
+    std::size_t skip[256];
+    buildHorspoolSkip(pattern, skip);
+
+    unsigned char last = static_cast<unsigned char>(pattern[m - 1]);
+    std::size_t i = 0;
+    while (i <= n - m) {
+        unsigned char c = static_cast<unsigned char>(text[i + m - 1]);
+        if (c == last && std::memcmp(text.data() + i, pattern.data(), m - 1) == 0) {
+            result.push_back(static_cast<int>(i));
+        }
+        i += skip[c];
+    }
+    return result;
+}
+
+namespace {
+
+// 计算最大后缀（按字节序，reversed 为 true 时使用相反的序），
+// 返回后缀起点减一（可能回绕为 SIZE_MAX），并通过 period 返回其周期
+std::size_t maximalSuffix(const unsigned char* x, std::size_t m, bool reversed, std::size_t& period) {
+    std::size_t ip = static_cast<std::size_t>(-1);
+    std::size_t jp = 0;
+    std::size_t k = 1;
+    std::size_t p = 1;
+
+    while (jp + k < m) {
+        unsigned char a = x[ip + k];
+        unsigned char b = x[jp + k];
+        if (a == b) {
+            if (k == p) {
+                jp += p;
+                k = 1;
+            } else {
+                k++;
+            }
+        } else if (reversed ? (a < b) : (a > b)) {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        } else {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    period = p;
+    return ip;
+}
+
+} // namespace
+
+TwoWaySearcher::TwoWaySearcher(std::string_view pattern)
+    : pattern_(pattern), critical_(0), period_(1), periodic_(false) {
+    std::size_t m = pattern_.size();
+    if (m == 0) return;
+
+    const unsigned char* x = reinterpret_cast<const unsigned char*>(pattern_.data());
+
+    // 临界分解：取两种字节序下最大后缀中较靠后的一个
+    std::size_t p1 = 1;
+    std::size_t p2 = 1;
+    std::size_t ms1 = maximalSuffix(x, m, false, p1);
+    std::size_t ms2 = maximalSuffix(x, m, true, p2);
+    std::size_t ms = ms1;
+    std::size_t p = p1;
+    if (ms2 + 1 > ms1 + 1) {
+        ms = ms2;
+        p = p2;
+    }
+    critical_ = ms + 1;
+
+    // 左半部分是右半部分周期的后缀时模式是周期性的，按周期移动并保留记忆；
+    // 否则周期大于 max(|u|, |v|)，按该下界移动不会漏掉重叠匹配
+    if (std::memcmp(x, x + p, critical_) == 0) {
+        periodic_ = true;
+        period_ = p;
+    } else {
+        periodic_ = false;
+        period_ = std::max(critical_, m - critical_) + 1;
+    }
+}
+
+std::vector<int> twoWaySearch(const std::string& text, const std::string& pattern) {
+    std::vector<int> result;
+    TwoWaySearcher searcher(pattern);
+    searcher.scan(text.data(), text.size(), [&result](std::size_t pos) {
+        result.push_back(static_cast<int>(pos));
+        return true;
+    });
+    return result;
+}
+
+StringSearchAlgorithm selectSearchAlgorithm(const std::string& pattern) {
+    std::size_t frequency[256] = {};
+    std::size_t distinct = 0;
+    std::size_t dominant = 0;
+    for (char ch : pattern) {
+        std::size_t& f = frequency[static_cast<unsigned char>(ch)];
+        if (f++ == 0) distinct++;
+        dominant = std::max(dominant, f);
+    }
+
+    // 模式几乎由一两种字节重复构成时，Horspool 每个窗口都可能比较到深处才失配、
+    // 且只移动 1 个字节；阈值见 benchmarks/string_search_benchmark 的 periodic 一栏
+    if (pattern.size() >= 4 && (distinct <= 2 || dominant * 4 >= pattern.size() * 3)) {
+        return StringSearchAlgorithm::TwoWay;
+    }
+    return StringSearchAlgorithm::Horspool;
+}
+
+std::vector<int> stringSearch(const std::string& text, const std::string& pattern,
+                              StringSearchAlgorithm algorithm) {
+    if (algorithm == StringSearchAlgorithm::Auto) {
+        algorithm = selectSearchAlgorithm(pattern);
+    }
+
+    switch (algorithm) {
+        case StringSearchAlgorithm::Horspool:
+            return horspoolSearch(text, pattern);
+        case StringSearchAlgorithm::TwoWay:
+            return twoWaySearch(text, pattern);
+        case StringSearchAlgorithm::KMP:
+        case StringSearchAlgorithm::Auto:
+        default:
+            return kmpSearch(text, pattern);
+    }
+}
+
+std::vector<int> simdSearch(const std::string& text, const std::string& pattern) {
+    return simdSearch(text, pattern, detail::detectSimdLevel());
+}
+
+std::vector<int> simdSearch(const std::string& text, const std::string& pattern, SimdLevel level) {
+    std::vector<int> result;
+    auto collect = [&result](std::size_t pos) {
+        result.push_back(static_cast<int>(pos));
+        return true;
+    };
+    detail::simdScan(text.data(), text.size(), pattern.data(), pattern.size(), level, collect);
+    return result;
+}
+
+std::size_t countMatches(const char* text, std::size_t n, const char* pattern, std::size_t m) noexcept {
+    std::size_t total = 0;
+    forEachMatch(text, n, pattern, m, [&total](std::size_t) { total++; });
+    return total;
+}
+
+std::size_t findFirstMatch(const char* text, std::size_t n, const char* pattern, std::size_t m) noexcept {
+    std::size_t first = std::string_view::npos;
+    forEachMatch(text, n, pattern, m, [&first](std::size_t pos) {
+        first = pos;
+        return false;
+    });
+    return first;
+}
+
+CompiledPattern::CompiledPattern(std::string pattern)
+    : pattern_(std::move(pattern)), prefixTable_(computePrefixTable(pattern_)), skip_() {
+    buildHorspoolSkip(pattern_, skip_);
+}
+
+std::size_t CompiledPattern::findFirst(std::string_view text) const {
+    std::size_t first = npos;
+    scan(text, [&first](std::size_t pos) {
+        first = pos;
+        return false;
+    });
+    return first;
+}
+
+std::size_t CompiledPattern::count(std::string_view text) const {
+    std::size_t total = 0;
+    scan(text, [&total](std::size_t) {
+        total++;
+        return true;
+    });
+    return total;
+}
+
+std::vector<std::size_t> CompiledPattern::findAll(std::string_view text) const {
+    std::vector<std::size_t> positions;
+    findAll(text, positions);
+    return positions;
+}
+
+void CompiledPattern::findAll(std::string_view text, std::vector<std::size_t>& positions) const {
+    positions.clear();
+    scan(text, [&positions](std::size_t pos) {
+        positions.push_back(pos);
+        return true;
+    });
+}
+
+StreamingMatcher::StreamingMatcher(std::string pattern, Callback onMatch)
+    : pattern_(std::move(pattern)), prefixTable_(computePrefixTable(pattern_)),
+      onMatch_(std::move(onMatch)), state_(0), offset_(0), matches_(0) {}
+
+void StreamingMatcher::feed(const char* data, std::size_t size) {
+    std::size_t m = pattern_.size();
+    if (m == 0) {
+        offset_ += size;
+        return;
+    }
+
+    std::size_t j = state_;
+    for (std::size_t i = 0; i < size; i++) {
+        while (j > 0 && pattern_[j] != data[i]) {
+            j = static_cast<std::size_t>(prefixTable_[j - 1]);
+        }
+        if (pattern_[j] == data[i]) j++;
+        if (j == m) {
+            matches_++;
+            if (onMatch_) {
+                onMatch_(offset_ + i + 1 - m);
+            }
+            j = static_cast<std::size_t>(prefixTable_[j - 1]);
+        }
+    }
+    state_ = j;
+    offset_ += size;
+}
+
+void StreamingMatcher::reset() noexcept {
+    state_ = 0;
+    offset_ = 0;
+    matches_ = 0;
+}
+
+ShiftOrMatcher::ShiftOrMatcher(std::string pattern, std::size_t maxMismatches)
+    : pattern_(std::move(pattern)), k_(maxMismatches), words_((pattern_.size() + 63) / 64),
+      mask_(), state_((k_ + 1) * words_, ~std::uint64_t(0)), offset_(0) {
+    std::size_t m = pattern_.size();
+    mask_.assign(256 * words_, ~std::uint64_t(0));
+    for (std::size_t j = 0; j < m; j++) {
+        unsigned char c = static_cast<unsigned char>(pattern_[j]);
+        mask_[c * words_ + j / 64] &= ~(std::uint64_t(1) << (j % 64));
+    }
+}
+
+void ShiftOrMatcher::reset() noexcept {
+    // state_ 在构造时已分配好大小，这里只重新填充，不会分配内存
+    std::fill(state_.begin(), state_.end(), ~std::uint64_t(0));
+    offset_ = 0;
+}
+
+MyersMatcher::MyersMatcher(std::string pattern, std::size_t maxDistance)
+    : pattern_(std::move(pattern)), k_(maxDistance), words_((pattern_.size() + 63) / 64),
+      peq_(), pv_(words_, ~std::uint64_t(0)), mv_(words_, 0),
+      score_(static_cast<long long>(pattern_.size())), offset_(0) {
+    std::size_t m = pattern_.size();
+    peq_.assign(256 * words_, 0);
+    for (std::size_t j = 0; j < m; j++) {
+        unsigned char c = static_cast<unsigned char>(pattern_[j]);
+        peq_[c * words_ + j / 64] |= std::uint64_t(1) << (j % 64);
+    }
+}
+
+void MyersMatcher::reset() noexcept {
+    // 第 0 列：D[i][0] = i，所有垂直差值为 +1；pv_、mv_ 在构造时已分配好大小
+    std::fill(pv_.begin(), pv_.end(), ~std::uint64_t(0));
+    std::fill(mv_.begin(), mv_.end(), 0);
+    score_ = static_cast<long long>(pattern_.size());
+    offset_ = 0;
+}
+
+std::vector<ApproximateMatch> findMismatchMatches(std::string_view text, std::string_view pattern,
+                                                  std::size_t maxMismatches) {
+    std::vector<ApproximateMatch> matches;
+    ShiftOrMatcher matcher(std::string(pattern), maxMismatches);
+    matcher.feed(text.data(), text.size(), [&matches](std::uint64_t start, std::size_t errors) {
+        matches.push_back({static_cast<std::size_t>(start), errors});
+    });
+    return matches;
+}
+
+std::vector<ApproximateMatch> findEditMatches(std::string_view text, std::string_view pattern,
+                                              std::size_t maxDistance) {
+    std::vector<ApproximateMatch> matches;
+    MyersMatcher matcher(std::string(pattern), maxDistance);
+    matcher.feed(text.data(), text.size(), [&matches](std::uint64_t end, std::size_t errors) {
+        matches.push_back({static_cast<std::size_t>(end), errors});
+    });
+    return matches;
+}
+
 } // namespace algorithms
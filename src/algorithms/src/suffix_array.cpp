@@ -0,0 +1,336 @@
+#include "algorithms/suffix_array.h"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace algorithms {
+
+namespace {
+
+constexpr char FILE_MAGIC[4] = {'S', 'A', 'I', 'X'};
+constexpr std::uint32_t FILE_VERSION = 1;
+
+// 短串直接比较排序，也作为 SA-IS 递归的终止条件
+std::vector<int> naiveSuffixSort(const std::vector<int>& s) {
+    int n = static_cast<int>(s.size());
+    std::vector<int> sa(n);
+    for (int i = 0; i < n; i++) sa[i] = i;
+    std::sort(sa.begin(), sa.end(), [&](int a, int b) {
+        if (a == b) return false;
+        while (a < n && b < n) {
+            if (s[a] != s[b]) return s[a] < s[b];
+            a++;
+            b++;
+        }
+        return a == n;
+    });
+    return sa;
+}
+
+/**
+ * SA-IS：s 的取值范围为 [0, upper]，返回后缀数组。
+ * 先按类型（S/L）找出 LMS 位置，诱导排序得到 LMS 子串的顺序，
+ * 若 LMS 子串有重复则对缩减串递归，最后用排好序的 LMS 后缀再诱导一次。
+ */
+std::vector<int> saIs(const std::vector<int>& s, int upper) {
+    int n = static_cast<int>(s.size());
+    if (n < 10) return naiveSuffixSort(s);
+
+    std::vector<int> sa(n);
+    std::vector<bool> isS(n, false);
+    for (int i = n - 2; i >= 0; i--) {
+        isS[i] = (s[i] == s[i + 1]) ? isS[i + 1] : (s[i] < s[i + 1]);
+    }
+
+    // sumL[c]：字符 c 的 L 型桶起点；sumS[c]：字符 c 的 S 型桶起点
+    std::vector<int> sumL(upper + 1, 0), sumS(upper + 1, 0);
+    for (int i = 0; i < n; i++) {
+        if (!isS[i]) {
+            sumS[s[i]]++;
+        } else {
+            sumL[s[i] + 1]++;
+        }
+    }
+    for (int c = 0; c <= upper; c++) {
+        sumS[c] += sumL[c];
+        if (c < upper) sumL[c + 1] += sumS[c];
+    }
+
+    std::vector<int> bucket(upper + 1);
+    auto induce = [&](const std::vector<int>& lms) {
+        std::fill(sa.begin(), sa.end(), -1);
+        std::copy(sumS.begin(), sumS.end(), bucket.begin());
+        for (int d : lms) {
+            if (d == n) continue;
+            sa[bucket[s[d]]++] = d;
+        }
+        std::copy(sumL.begin(), sumL.end(), bucket.begin());
+        sa[bucket[s[n - 1]]++] = n - 1;
+        for (int i = 0; i < n; i++) {
+            int v = sa[i];
+            if (v >= 1 && !isS[v - 1]) {
+                sa[bucket[s[v - 1]]++] = v - 1;
+            }
+        }
+        std::copy(sumL.begin(), sumL.end(), bucket.begin());
+        for (int i = n - 1; i >= 0; i--) {
+            int v = sa[i];
+            if (v >= 1 && isS[v - 1]) {
+                sa[--bucket[s[v - 1] + 1]] = v - 1;
+            }
+        }
+    };
+
+    std::vector<int> lmsMap(n + 1, -1);
+    std::vector<int> lms;
+    for (int i = 1; i < n; i++) {
+        if (!isS[i - 1] && isS[i]) {
+            lmsMap[i] = static_cast<int>(lms.size());
+            lms.push_back(i);
+        }
+    }
+    int m = static_cast<int>(lms.size());
+
+    induce(lms);
+    if (m == 0) return sa;
+
+    std::vector<int> sortedLms;
+    sortedLms.reserve(m);
+    for (int v : sa) {
+        if (lmsMap[v] != -1) sortedLms.push_back(v);
+    }
+
+    // 给 LMS 子串编号，相同的子串得到相同的编号
+    std::vector<int> reduced(m);
+    int reducedUpper = 0;
+    reduced[lmsMap[sortedLms[0]]] = 0;
+    for (int i = 1; i < m; i++) {
+        int l = sortedLms[i - 1];
+        int r = sortedLms[i];
+        int endL = (lmsMap[l] + 1 < m) ? lms[lmsMap[l] + 1] : n;
+        int endR = (lmsMap[r] + 1 < m) ? lms[lmsMap[r] + 1] : n;
+        bool same = true;
+        if (endL - l != endR - r) {
+            same = false;
+        } else {
+            while (l < endL && s[l] == s[r]) {
+                l++;
+                r++;
+            }
+            if (l == n || s[l] != s[r]) same = false;
+        }
+        if (!same) reducedUpper++;
+        reduced[lmsMap[sortedLms[i]]] = reducedUpper;
+    }
+
+    std::vector<int> reducedSa = saIs(reduced, reducedUpper);
+    for (int i = 0; i < m; i++) {
+        sortedLms[i] = lms[reducedSa[i]];
+    }
+    induce(sortedLms);
+    return sa;
+}
+
+void writeU32(std::ostream& out, std::uint32_t value) {
+    char bytes[4];
+    for (int i = 0; i < 4; i++) bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    out.write(bytes, 4);
+}
+
+std::uint32_t readU32(std::istream& in) {
+    unsigned char bytes[4] = {0, 0, 0, 0};
+    in.read(reinterpret_cast<char*>(bytes), 4);
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; i++) value |= static_cast<std::uint32_t>(bytes[i]) << (8 * i);
+    return value;
+}
+
+// 文件固定为小端字节序；小端主机上数组整块读写，大端主机上逐个交换字节
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool HOST_LITTLE_ENDIAN = false;
+#else
+constexpr bool HOST_LITTLE_ENDIAN = true;
+#endif
+
+std::uint32_t byteSwap(std::uint32_t v) {
+    return (v >> 24) | ((v >> 8) & 0xff00u) | ((v << 8) & 0xff0000u) | (v << 24);
+}
+
+void writeArray(std::ostream& out, const std::vector<std::uint32_t>& values) {
+    if (!HOST_LITTLE_ENDIAN) {
+        for (std::uint32_t v : values) writeU32(out, v);
+        return;
+    }
+    out.write(reinterpret_cast<const char*>(values.data()),
+              static_cast<std::streamsize>(values.size() * sizeof(std::uint32_t)));
+}
+
+void readArray(std::istream& in, std::vector<std::uint32_t>& values, std::size_t n) {
+    values.resize(n);
+    in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(n * sizeof(std::uint32_t)));
+    if (!HOST_LITTLE_ENDIAN) {
+        for (std::uint32_t& v : values) v = byteSwap(v);
+    }
+}
+
+} // namespace
+
+SuffixArray::SuffixArray(std::string text) : text_(std::move(text)), sa_(), lcp_() {
+    std::size_t n = text_.size();
+    if (n > MAX_TEXT_LENGTH) {
+        throw std::length_error("后缀数组的文本过长（最大支持2^31-1字节）");
+    }
+    if (n == 0) return;
+
+    std::vector<int> s(n);
+    for (std::size_t i = 0; i < n; i++) s[i] = static_cast<unsigned char>(text_[i]);
+    std::vector<int> sa = saIs(s, 255);
+    sa_.assign(sa.begin(), sa.end());
+
+    // Kasai：按文本顺序处理后缀，相邻后缀的 LCP 每步最多减少 1
+    std::vector<std::uint32_t> rank(n);
+    for (std::size_t i = 0; i < n; i++) rank[sa_[i]] = static_cast<std::uint32_t>(i);
+    lcp_.assign(n, 0);
+    std::size_t h = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        if (h > 0) h--;
+        if (rank[i] == 0) {
+            h = 0;
+            continue;
+        }
+        std::size_t j = sa_[rank[i] - 1];
+        while (i + h < n && j + h < n && text_[i + h] == text_[j + h]) h++;
+        lcp_[rank[i]] = static_cast<std::uint32_t>(h);
+    }
+}
+
+std::size_t SuffixArray::bound(std::string_view pattern, bool upper) const {
+    std::size_t n = text_.size();
+    std::size_t m = pattern.size();
+    // 不变式：lo 处的后缀在目标位置之前，hi 处的后缀在目标位置之后（lo = -1、hi = n 为虚拟哨兵）
+    std::ptrdiff_t lo = -1;
+    std::ptrdiff_t hi = static_cast<std::ptrdiff_t>(n);
+    std::size_t l = 0;
+    std::size_t r = 0;
+
+    while (hi - lo > 1) {
+        std::ptrdiff_t mid = lo + (hi - lo) / 2;
+        std::size_t start = sa_[static_cast<std::size_t>(mid)];
+        // lo 和 hi 之间的后缀与模式至少有 min(l, r) 个公共字符
+        std::size_t k = std::min(l, r);
+        while (k < m && start + k < n && text_[start + k] == pattern[k]) k++;
+
+        bool before;
+        if (k == m) {
+            before = upper;
+        } else if (start + k == n) {
+            before = true;
+        } else {
+            before = static_cast<unsigned char>(text_[start + k]) <
+                     static_cast<unsigned char>(pattern[k]);
+        }
+
+        if (before) {
+            lo = mid;
+            l = k;
+        } else {
+            hi = mid;
+            r = k;
+        }
+    }
+    return static_cast<std::size_t>(hi);
+}
+
+std::pair<std::size_t, std::size_t> SuffixArray::range(std::string_view pattern) const {
+    if (pattern.empty() || pattern.size() > text_.size()) return {0, 0};
+    std::size_t first = bound(pattern, false);
+    std::size_t last = bound(pattern, true);
+    return {first, last};
+}
+
+std::size_t SuffixArray::count(std::string_view pattern) const {
+    auto [first, last] = range(pattern);
+    return last - first;
+}
+
+std::vector<std::size_t> SuffixArray::locate(std::string_view pattern) const {
+    auto [first, last] = range(pattern);
+    std::vector<std::size_t> positions(sa_.begin() + static_cast<std::ptrdiff_t>(first),
+                                       sa_.begin() + static_cast<std::ptrdiff_t>(last));
+    std::sort(positions.begin(), positions.end());
+    return positions;
+}
+
+std::string_view SuffixArray::longestRepeatedSubstring() const {
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < lcp_.size(); i++) {
+        if (lcp_[i] > lcp_[best]) best = i;
+    }
+    if (lcp_.empty() || lcp_[best] == 0) return std::string_view();
+    return std::string_view(text_).substr(sa_[best], lcp_[best]);
+}
+
+void SuffixArray::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("无法写入后缀数组文件: " + path);
+    }
+    out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    writeU32(out, FILE_VERSION);
+    writeU32(out, static_cast<std::uint32_t>(text_.size()));
+    out.write(text_.data(), static_cast<std::streamsize>(text_.size()));
+    writeArray(out, sa_);
+    writeArray(out, lcp_);
+    if (!out) {
+        throw std::runtime_error("无法写入后缀数组文件: " + path);
+    }
+}
+
+SuffixArray SuffixArray::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("无法打开后缀数组文件: " + path);
+    }
+
+    char magic[sizeof(FILE_MAGIC)] = {};
+    in.read(magic, sizeof(magic));
+    if (!in || !std::equal(magic, magic + sizeof(magic), FILE_MAGIC) || readU32(in) != FILE_VERSION) {
+        throw std::runtime_error("后缀数组文件格式不正确: " + path);
+    }
+
+    std::size_t n = readU32(in);
+    if (!in || n > MAX_TEXT_LENGTH) {
+        throw std::runtime_error("后缀数组文件格式不正确: " + path);
+    }
+
+    // 先确认文件确实包含 n 字节文本和两个 n 项数组，再按 n 分配内存
+    std::streampos body = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::streamoff remaining = in.tellg() - body;
+    in.seekg(body);
+    if (!in || remaining < static_cast<std::streamoff>(n) * 9) {
+        throw std::runtime_error("后缀数组文件已截断: " + path);
+    }
+
+    SuffixArray index;
+    index.text_.resize(n);
+    in.read(&index.text_[0], static_cast<std::streamsize>(n));
+    readArray(in, index.sa_, n);
+    readArray(in, index.lcp_, n);
+    if (!in) {
+        throw std::runtime_error("后缀数组文件已截断: " + path);
+    }
+    for (std::uint32_t pos : index.sa_) {
+        if (pos >= n) {
+            throw std::runtime_error("后缀数组文件格式不正确: " + path);
+        }
+    }
+    return index;
+}
+
+std::size_t SuffixArray::memoryBytes() const noexcept {
+    return sizeof(*this) + text_.capacity() +
+           (sa_.capacity() + lcp_.capacity()) * sizeof(std::uint32_t);
+}
+
+} // namespace algorithms
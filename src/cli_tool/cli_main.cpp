@@ -1,19 +1,118 @@
 #include <iostream>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <vector>
 #include <algorithm>
 #include "algorithms/sort.h"
 #include "algorithms/search.h"
+#include "algorithms/diff.h"
 
 void printUsage() {
     std::cout << "使用方法: cli_tool <命令> [参数]" << std::endl;
     std::cout << "\n可用命令:" << std::endl;
     std::cout << "  sort <数字...>      - 对数字进行排序（使用快速排序）" << std::endl;
     std::cout << "  search <目标> <数字...> - 在已排序数组中查找目标值（使用二分查找）" << std::endl;
+    std::cout << "  diff <文件1> <文件2>  - 逐行比较两个文件（Myers 差分，普通 diff 格式输出）" << std::endl;
     std::cout << "  help                - 显示此帮助信息" << std::endl;
     std::cout << "\n示例:" << std::endl;
     std::cout << "  cli_tool sort 5 2 8 1 9" << std::endl;
     std::cout << "  cli_tool search 5 1 2 5 8 9" << std::endl;
+    std::cout << "  cli_tool diff old.conf new.conf" << std::endl;
+}
+
+// 只读取普通文件；目录、设备等其他类型的路径视为错误
+bool readFile(const std::string& path, std::string& content) {
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec)) return false;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::ostringstream buffer;
+    buffer << in.rdbuf();
+    if (in.bad()) return false;
+    content = buffer.str();
+    return true;
+}
+
+// 按 '\n' 拆分，每行保留结尾的 '\n'（以及可能存在的 '\r'），
+// 因此行尾不同或末尾缺少换行的行与其他行不相等
+std::vector<std::string_view> splitRawLines(std::string_view text) {
+    std::vector<std::string_view> lines;
+    std::size_t start = 0;
+    while (start < text.size()) {
+        std::size_t end = text.find('\n', start);
+        end = end == std::string_view::npos ? text.size() : end + 1;
+        lines.push_back(text.substr(start, end - start));
+        start = end;
+    }
+    return lines;
+}
+
+// 输出一行（去掉结尾的 '\n'）；没有换行的最后一行后面附加与 diff 相同的提示
+void printLine(const char* prefix, std::string_view line) {
+    bool terminated = !line.empty() && line.back() == '\n';
+    if (terminated) line.remove_suffix(1);
+    std::cout << prefix << line << "\n";
+    if (!terminated) std::cout << "\\ No newline at end of file\n";
+}
+
+// 行范围（1 起始）：单行输出 "3"，多行输出 "3,5"
+std::string lineRange(std::size_t start, std::size_t length) {
+    if (length <= 1) return std::to_string(start + 1);
+    return std::to_string(start + 1) + "," + std::to_string(start + length);
+}
+
+// 按传统 diff 的普通格式输出："2,3c2"、"5d4"、"7a8,9"，随后是 "< " 和 "> " 开头的行
+int runDiff(const std::string& oldPath, const std::string& newPath) {
+    std::string oldText, newText;
+    if (!readFile(oldPath, oldText)) {
+        std::cerr << "错误: 无法读取文件 '" << oldPath << "'（必须是普通文件）" << std::endl;
+        return 2;
+    }
+    if (!readFile(newPath, newText)) {
+        std::cerr << "错误: 无法读取文件 '" << newPath << "'（必须是普通文件）" << std::endl;
+        return 2;
+    }
+
+    std::vector<std::string_view> oldLines = splitRawLines(oldText);
+    std::vector<std::string_view> newLines = splitRawLines(newText);
+    std::vector<algorithms::DiffEdit> script = algorithms::diffSequences(oldLines, newLines);
+
+    bool changed = false;
+    for (std::size_t i = 0; i < script.size(); i++) {
+        const algorithms::DiffEdit& edit = script[i];
+        if (edit.op == algorithms::DiffOp::Equal) continue;
+        changed = true;
+
+        if (edit.op == algorithms::DiffOp::Delete) {
+            bool replaced = i + 1 < script.size() && script[i + 1].op == algorithms::DiffOp::Insert;
+            if (replaced) {
+                const algorithms::DiffEdit& insert = script[i + 1];
+                std::cout << lineRange(edit.oldStart, edit.length) << "c"
+                          << lineRange(insert.newStart, insert.length) << "\n";
+            } else {
+                std::cout << lineRange(edit.oldStart, edit.length) << "d" << edit.newStart << "\n";
+            }
+            for (std::size_t k = 0; k < edit.length; k++) {
+                printLine("< ", oldLines[edit.oldStart + k]);
+            }
+            if (!replaced) continue;
+            std::cout << "---\n";
+            i++;
+        } else {
+            std::cout << edit.oldStart << "a" << lineRange(edit.newStart, edit.length) << "\n";
+        }
+
+        const algorithms::DiffEdit& insert = script[i];
+        for (std::size_t k = 0; k < insert.length; k++) {
+            printLine("> ", newLines[insert.newStart + k]);
+        }
+    }
+    std::cout.flush();
+    return changed ? 1 : 0;
 }
 
 int main(int argc, char* argv[]) {
@@ -106,6 +205,14 @@ int main(int argc, char* argv[]) {
             std::cout << "未找到目标值 " << target << std::endl;
         }
         
+    } else if (command == "diff") {
+        if (argc != 4) {
+            std::cerr << "错误: diff 命令需要两个文件参数" << std::endl;
+            return 2;
+        }
+        // 与 diff 工具一致：0 表示相同，1 表示有差异，2 表示出错
+        return runDiff(argv[2], argv[3]);
+
     } else {
         std::cerr << "错误: 未知命令 '" << command << "'" << std::endl;
         printUsage();
@@ -0,0 +1,3 @@
+// bloom_filter.cpp
+// 空实现文件，用于 CMake 构建系统
+// BlockedBloomFilter 是模板类，所有实现都在头文件中
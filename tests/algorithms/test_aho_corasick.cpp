@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "algorithms/aho_corasick.h"
+#include "algorithms/string_algorithms.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using algorithms::AhoCorasick;
+using algorithms::PatternMatch;
+
+// 测试AC自动机 - 经典示例
+TEST(AhoCorasickTest, ClassicExample) {
+    AhoCorasick ac({"he", "she", "his", "hers"});
+    auto matches = ac.findAll("ushers");
+
+    std::vector<PatternMatch> expected = {{1, 1}, {0, 2}, {3, 2}};
+    EXPECT_EQ(matches, expected);
+    EXPECT_EQ(ac.count("ushers"), 3u);
+    EXPECT_EQ(ac.patternCount(), 4u);
+}
+
+// 测试AC自动机 - 无匹配、空文本和空模式
+TEST(AhoCorasickTest, EmptyInputs) {
+    AhoCorasick ac({"abc", ""});
+    EXPECT_TRUE(ac.findAll("").empty());
+    EXPECT_TRUE(ac.findAll("xyz xyz").empty());
+
+    AhoCorasick none({});
+    EXPECT_TRUE(none.findAll("anything").empty());
+}
+
+// 测试AC自动机 - 重叠匹配与重复模式
+TEST(AhoCorasickTest, OverlappingAndDuplicatePatterns) {
+    AhoCorasick ac({"aa", "a", "aa"});
+    auto matches = ac.findAll("aaa");
+
+    // 结束位置相同时较长模式先报告
+    std::vector<PatternMatch> expected = {
+        {1, 0},
+        {0, 0}, {2, 0}, {1, 1},
+        {0, 1}, {2, 1}, {1, 2}
+    };
+    EXPECT_EQ(matches, expected);
+}
+
+// 测试AC自动机 - 最左最长匹配
+TEST(AhoCorasickTest, LeftmostLongest) {
+    AhoCorasick ac({"abcd", "bc", "ab", "cde", "e"});
+    auto matches = ac.findAll("abcde", AhoCorasick::MatchKind::LeftmostLongest);
+
+    std::vector<PatternMatch> expected = {{0, 0}, {4, 4}};
+    EXPECT_EQ(matches, expected);
+}
+
+// 测试AC自动机 - 单遍最左最长与"全部匹配排序后贪心选取"一致（含重复模式、空模式与不等长重叠）
+TEST(AhoCorasickTest, LeftmostLongestMatchesGreedyReference) {
+    std::mt19937 gen(31);
+    std::uniform_int_distribution<int> letter('a', 'c');
+    for (int round = 0; round < 100; round++) {
+        std::vector<std::string> patterns(1 + gen() % 30);
+        for (auto& p : patterns) {
+            p.resize(gen() % 9);
+            for (char& c : p) c = static_cast<char>(letter(gen));
+        }
+        std::string text(gen() % 300, ' ');
+        for (char& c : text) c = static_cast<char>(letter(gen));
+        AhoCorasick ac(patterns);
+
+        // 参考实现：按起点升序、长度降序、编号升序排序后贪心选取
+        auto all = ac.findAll(text);
+        std::stable_sort(all.begin(), all.end(), [&](const PatternMatch& a, const PatternMatch& b) {
+            if (a.position != b.position) return a.position < b.position;
+            if (patterns[a.patternId].size() != patterns[b.patternId].size()) {
+                return patterns[a.patternId].size() > patterns[b.patternId].size();
+            }
+            return a.patternId < b.patternId;
+        });
+        std::vector<PatternMatch> expected;
+        std::size_t nextFree = 0;
+        for (const PatternMatch& m : all) {
+            if (m.position < nextFree) continue;
+            expected.push_back(m);
+            nextFree = m.position + patterns[m.patternId].size();
+        }
+
+        ASSERT_EQ(ac.findAll(text, AhoCorasick::MatchKind::LeftmostLongest), expected) << "round=" << round;
+    }
+}
+
+// 测试AC自动机 - 二进制字节
+TEST(AhoCorasickTest, BinaryBytes) {
+    std::string p1("\x00\xff", 2);
+    std::string p2("\xff\x00", 2);
+    std::string text("\x00\xff\x00\xff", 4);
+    AhoCorasick ac({p1, p2});
+
+    std::vector<PatternMatch> expected = {{0, 0}, {1, 1}, {0, 2}};
+    EXPECT_EQ(ac.findAll(text), expected);
+}
+
+// 测试AC自动机 - 随机模式集与逐个KMP结果一致
+TEST(AhoCorasickTest, MatchesPerPatternKmp) {
+    std::mt19937 gen(17);
+    std::uniform_int_distribution<int> letter('a', 'd');
+    std::uniform_int_distribution<int> len(1, 6);
+
+    std::vector<std::string> patterns(200);
+    for (auto& p : patterns) {
+        p.resize(len(gen));
+        for (char& c : p) c = static_cast<char>(letter(gen));
+    }
+    std::string text(5000, ' ');
+    for (char& c : text) c = static_cast<char>(letter(gen));
+
+    AhoCorasick ac(patterns);
+    EXPECT_LE(ac.alphabetSize(), 5u);
+
+    std::vector<std::pair<std::size_t, std::size_t>> actual;
+    ac.forEachMatch(text, [&](std::size_t id, std::size_t pos) { actual.emplace_back(id, pos); });
+
+    std::vector<std::pair<std::size_t, std::size_t>> expected;
+    for (std::size_t id = 0; id < patterns.size(); id++) {
+        for (int pos : algorithms::kmpSearch(text, patterns[id])) {
+            expected.emplace_back(id, static_cast<std::size_t>(pos));
+        }
+    }
+
+    std::sort(actual.begin(), actual.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(actual, expected);
+}
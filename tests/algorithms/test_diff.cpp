@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "algorithms/diff.h"
+#include "algorithms/dp_algorithms.h"
+#include <random>
+#include <string>
+#include <vector>
+
+using algorithms::DiffEdit;
+using algorithms::DiffOp;
+
+namespace {
+
+// 校验编辑脚本：各段首尾相接、覆盖两个序列、Equal 段内容相同、相邻段类型不同
+template<typename Seq>
+void expectValidScript(const std::vector<DiffEdit>& script, const Seq& oldSeq, const Seq& newSeq) {
+    std::size_t oldPos = 0, newPos = 0;
+    for (std::size_t i = 0; i < script.size(); i++) {
+        const DiffEdit& edit = script[i];
+        ASSERT_GT(edit.length, 0u);
+        ASSERT_EQ(edit.oldStart, oldPos);
+        ASSERT_EQ(edit.newStart, newPos);
+        if (i > 0) {
+            ASSERT_NE(edit.op, script[i - 1].op);
+        }
+        switch (edit.op) {
+            case DiffOp::Equal:
+                for (std::size_t k = 0; k < edit.length; k++) {
+                    ASSERT_EQ(oldSeq[oldPos + k], newSeq[newPos + k]);
+                }
+                oldPos += edit.length;
+                newPos += edit.length;
+                break;
+            case DiffOp::Delete:
+                ASSERT_TRUE(i + 1 == script.size() || script[i + 1].op != DiffOp::Delete);
+                oldPos += edit.length;
+                break;
+            case DiffOp::Insert:
+                ASSERT_TRUE(i == 0 || script[i - 1].op != DiffOp::Insert);
+                newPos += edit.length;
+                break;
+        }
+    }
+    EXPECT_EQ(oldPos, static_cast<std::size_t>(oldSeq.size()));
+    EXPECT_EQ(newPos, static_cast<std::size_t>(newSeq.size()));
+}
+
+std::string randomString(std::mt19937& gen, std::size_t length, int alphabet) {
+    std::string s(length, 'a');
+    for (char& c : s) c = static_cast<char>('a' + static_cast<int>(gen() % alphabet));
+    return s;
+}
+
+} // namespace
+
+// 测试差分 - 文档示例与空序列
+TEST(DiffTest, BasicScripts) {
+    std::vector<DiffEdit> expected = {
+        {DiffOp::Equal, 0, 0, 1}, {DiffOp::Delete, 1, 1, 1}, {DiffOp::Equal, 2, 1, 1}, {DiffOp::Insert, 3, 2, 1}};
+    EXPECT_EQ(algorithms::myersDiff({1, 2, 3}, {1, 3, 4}), expected);
+    EXPECT_EQ(algorithms::diffLines("a\nb\nc\n", "a\nc\nd\n"), expected);
+
+    EXPECT_TRUE(algorithms::myersDiff({}, {}).empty());
+    EXPECT_EQ(algorithms::myersDiff({}, {7, 8}), (std::vector<DiffEdit>{{DiffOp::Insert, 0, 0, 2}}));
+    EXPECT_EQ(algorithms::myersDiff({7, 8}, {}), (std::vector<DiffEdit>{{DiffOp::Delete, 0, 0, 2}}));
+    EXPECT_EQ(algorithms::myersDiff({1, 2}, {1, 2}), (std::vector<DiffEdit>{{DiffOp::Equal, 0, 0, 2}}));
+}
+
+// 测试差分 - 替换区域合并为先删除后插入
+TEST(DiffTest, ReplacementIsDeleteThenInsert) {
+    auto script = algorithms::diffStrings("xabcx", "xdefx");
+    std::vector<DiffEdit> expected = {
+        {DiffOp::Equal, 0, 0, 1}, {DiffOp::Delete, 1, 1, 3}, {DiffOp::Insert, 4, 1, 3}, {DiffOp::Equal, 4, 4, 1}};
+    EXPECT_EQ(script, expected);
+}
+
+// 测试差分 - 随机输入的编辑距离最小（等于 n + m - 2 * LCS）且脚本有效
+TEST(DiffTest, MinimalOnRandomInputs) {
+    std::mt19937 gen(491);
+    for (int round = 0; round < 300; round++) {
+        int alphabet = 1 + static_cast<int>(gen() % 6);
+        std::string a = randomString(gen, gen() % 120, alphabet);
+        std::string b = randomString(gen, gen() % 120, alphabet);
+
+        auto script = algorithms::diffStrings(a, b);
+        expectValidScript(script, a, b);
+        int lcs = algorithms::longestCommonSubsequence(a, b);
+        ASSERT_EQ(algorithms::diffDistance(script), a.size() + b.size() - 2 * static_cast<std::size_t>(lcs))
+            << "a=" << a << " b=" << b;
+    }
+}
+
+// 测试差分 - 行拆分支持 \r\n 和末尾无换行
+TEST(DiffTest, SplitLines) {
+    EXPECT_TRUE(algorithms::splitLines("").empty());
+    EXPECT_EQ(algorithms::splitLines("a\r\nb\n\nc"), (std::vector<std::string_view>{"a", "b", "", "c"}));
+    EXPECT_EQ(algorithms::splitLines("x\n"), (std::vector<std::string_view>{"x"}));
+}
+
+// 测试差分 - 通用记号序列（字符串与 64 位编号）
+TEST(DiffTest, GenericTokenSequences) {
+    std::vector<std::string> oldWords = {"the", "quick", "brown", "fox"};
+    std::vector<std::string> newWords = {"the", "slow", "brown", "fox", "jumps"};
+    auto script = algorithms::diffSequences(oldWords, newWords);
+    expectValidScript(script, oldWords, newWords);
+    EXPECT_EQ(algorithms::diffDistance(script), 3u);
+
+    std::vector<std::uint64_t> oldIds = {1ULL << 40, 5, 1ULL << 41, 7};
+    std::vector<std::uint64_t> newIds = {5, 1ULL << 41, 7, 1ULL << 42};
+    auto idScript = algorithms::diffSequences(oldIds, newIds);
+    expectValidScript(idScript, oldIds, newIds);
+    EXPECT_EQ(algorithms::diffDistance(idScript), 2u);
+}
+
+// 测试差分 - 几乎相同的大配置文件只做少量工作
+TEST(DiffTest, LargeNearlyIdenticalFiles) {
+    std::string oldText, newText;
+    for (int i = 0; i < 200000; i++) {
+        std::string line = "key" + std::to_string(i) + " = value" + std::to_string(i * 7) + "\n";
+        oldText += line;
+        if (i == 1000) newText += "key1000 = changed\n";
+        else if (i == 50000) continue;
+        else newText += line;
+        if (i == 150000) newText += "inserted = true\n";
+    }
+
+    auto script = algorithms::diffLines(oldText, newText);
+    expectValidScript(script, algorithms::splitLines(oldText), algorithms::splitLines(newText));
+    EXPECT_EQ(algorithms::diffDistance(script), 4u);
+    EXPECT_EQ(script.size(), 8u);
+}
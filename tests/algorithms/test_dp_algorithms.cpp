@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 #include "algorithms/dp_algorithms.h"
+#include "algorithms/detail/dp_kernels.h"
+#include "algorithms/detail/bit_parallel_lcs.h"
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
 
 // 测试0-1背包 - 基本功能
 TEST(Knapsack01Test, BasicFunctionality) {
@@ -299,4 +306,548 @@ TEST(GetLongestCommonSubsequenceTest, SpecificBacktrackPath) {
 
     std::string result = algorithms::getLongestCommonSubsequence(s1, s2);
     EXPECT_EQ(result, "AC");
-}
\ No newline at end of file
+}
+// ========== 新增：背包物品重建测试 ==========
+
+// 测试0-1背包 - 经典示例的选中物品
+TEST(Knapsack01WithItemsTest, ClassicExample) {
+    std::vector<int> weights = {2, 3, 4, 5};
+    std::vector<int> values = {3, 4, 5, 6};
+
+    algorithms::KnapsackSolution solution = algorithms::knapsack01WithItems(weights, values, 8);
+    EXPECT_EQ(solution.maxValue, 10);
+    EXPECT_EQ(solution.selectedItems, (std::vector<int>{1, 3}));
+}
+
+// 测试0-1背包 - 空输入、零容量与零重量物品
+TEST(Knapsack01WithItemsTest, EdgeCases) {
+    EXPECT_EQ(algorithms::knapsack01WithItems({}, {}, 10).maxValue, 0);
+    EXPECT_TRUE(algorithms::knapsack01WithItems({1, 2}, {5, 6}, 0).selectedItems.empty());
+
+    // 零重量物品总是值得放入，负价值物品从不放入
+    algorithms::KnapsackSolution solution = algorithms::knapsack01WithItems({0, 3, 1}, {7, 5, -2}, 3);
+    EXPECT_EQ(solution.maxValue, 12);
+    EXPECT_EQ(solution.selectedItems, (std::vector<int>{0, 1}));
+}
+
+// 测试0-1背包 - 负数重量与其他非法输入
+TEST(Knapsack01WithItemsTest, InvalidInput) {
+    EXPECT_THROW(algorithms::knapsack01({1, -2}, {3, 4}, 5), std::invalid_argument);
+    EXPECT_THROW(algorithms::knapsack01WithItems({1, -2}, {3, 4}, 5), std::invalid_argument);
+    EXPECT_THROW(algorithms::knapsack01WithItems({1}, {3, 4}, 5), std::invalid_argument);
+    EXPECT_THROW(algorithms::knapsack01WithItems({1}, {3}, -1), std::invalid_argument);
+    EXPECT_THROW(algorithms::knapsack01WithItems({1}, {3}, 100001), std::invalid_argument);
+}
+
+// 测试0-1背包 - 随机实例与穷举结果对比，选中物品满足容量且价值一致
+TEST(Knapsack01WithItemsTest, MatchesBruteForce) {
+    std::mt19937 gen(42);
+    for (int round = 0; round < 200; round++) {
+        int n = static_cast<int>(gen() % 12);
+        int capacity = static_cast<int>(gen() % 40);
+        std::vector<int> weights(n), values(n);
+        for (int i = 0; i < n; i++) {
+            weights[i] = static_cast<int>(gen() % 15);
+            values[i] = static_cast<int>(gen() % 30);
+        }
+
+        int best = 0;
+        for (int mask = 0; mask < (1 << n); mask++) {
+            int weight = 0, value = 0;
+            for (int i = 0; i < n; i++) {
+                if (mask & (1 << i)) {
+                    weight += weights[i];
+                    value += values[i];
+                }
+            }
+            if (weight <= capacity) best = std::max(best, value);
+        }
+
+        EXPECT_EQ(algorithms::knapsack01(weights, values, capacity), best);
+        algorithms::KnapsackSolution solution = algorithms::knapsack01WithItems(weights, values, capacity);
+        EXPECT_EQ(solution.maxValue, best);
+
+        int weight = 0, value = 0;
+        for (int item : solution.selectedItems) {
+            weight += weights[item];
+            value += values[item];
+        }
+        EXPECT_LE(weight, capacity);
+        EXPECT_EQ(value, best);
+        EXPECT_TRUE(std::is_sorted(solution.selectedItems.begin(), solution.selectedItems.end()));
+    }
+}
+
+// 测试0-1背包 - 最大容量下只占用单行内存
+TEST(Knapsack01WithItemsTest, MaximumCapacity) {
+    std::vector<int> weights(200), values(200);
+    for (int i = 0; i < 200; i++) {
+        weights[i] = 1000 + i * 7;
+        values[i] = 3 * i + 1;
+    }
+    int expected = algorithms::knapsack01(weights, values, 100000);
+    algorithms::KnapsackSolution solution = algorithms::knapsack01WithItems(weights, values, 100000);
+    EXPECT_EQ(solution.maxValue, expected);
+
+    int weight = 0;
+    for (int item : solution.selectedItems) weight += weights[item];
+    EXPECT_LE(weight, 100000);
+}
+
+// ========== 新增：大容量背包测试 ==========
+
+namespace {
+
+// 辅助函数：校验解的合法性并返回选中物品的总价值
+long long checkLargeSolution(const std::vector<long long>& weights, const std::vector<long long>& values,
+                             long long capacity, const algorithms::LargeKnapsackSolution& solution) {
+    long long weight = 0, value = 0;
+    for (int item : solution.selectedItems) {
+        weight += weights[item];
+        value += values[item];
+    }
+    EXPECT_LE(weight, capacity);
+    EXPECT_TRUE(std::is_sorted(solution.selectedItems.begin(), solution.selectedItems.end()));
+    EXPECT_TRUE(std::adjacent_find(solution.selectedItems.begin(), solution.selectedItems.end()) ==
+                solution.selectedItems.end());
+    return value;
+}
+
+const algorithms::KnapsackSolver kAllSolvers[] = {
+    algorithms::KnapsackSolver::CapacityDP, algorithms::KnapsackSolver::ValueDP,
+    algorithms::KnapsackSolver::Pareto, algorithms::KnapsackSolver::BranchAndBound,
+    algorithms::KnapsackSolver::Auto};
+
+} // namespace
+
+// 测试大容量背包 - 数十亿容量的示例
+TEST(LargeKnapsackTest, BillionCapacity) {
+    std::vector<long long> weights = {4000000000LL, 3000000000LL, 2000000000LL};
+    std::vector<long long> values = {40, 33, 25};
+    long long capacity = 5000000000LL;
+
+    EXPECT_EQ(algorithms::selectKnapsackSolver(weights, values, capacity), algorithms::KnapsackSolver::ValueDP);
+    for (auto solver : {algorithms::KnapsackSolver::ValueDP, algorithms::KnapsackSolver::Pareto,
+                        algorithms::KnapsackSolver::BranchAndBound, algorithms::KnapsackSolver::Auto}) {
+        auto solution = algorithms::knapsack01Large(weights, values, capacity, solver);
+        EXPECT_EQ(solution.maxValue, 58);
+        EXPECT_EQ(solution.selectedItems, (std::vector<int>{1, 2}));
+    }
+    EXPECT_THROW(algorithms::knapsack01Large(weights, values, capacity, algorithms::KnapsackSolver::CapacityDP),
+                 std::invalid_argument);
+}
+
+// 测试大容量背包 - 与 knapsack01 一致（所有算法）
+TEST(LargeKnapsackTest, AllSolversMatchSmallDP) {
+    std::mt19937 gen(43);
+    for (int round = 0; round < 100; round++) {
+        int n = static_cast<int>(gen() % 15);
+        int capacity = static_cast<int>(gen() % 200);
+        std::vector<int> weights(n), values(n);
+        for (int i = 0; i < n; i++) {
+            weights[i] = static_cast<int>(gen() % 60);
+            values[i] = static_cast<int>(gen() % 100) - 10;
+        }
+        int expected = algorithms::knapsack01(weights, values, capacity);
+
+        std::vector<long long> w(weights.begin(), weights.end());
+        std::vector<long long> v(values.begin(), values.end());
+        for (auto solver : kAllSolvers) {
+            auto solution = algorithms::knapsack01Large(w, v, capacity, solver);
+            EXPECT_EQ(solution.maxValue, expected) << static_cast<int>(solver);
+            EXPECT_EQ(checkLargeSolution(w, v, capacity, solution), expected);
+        }
+    }
+}
+
+// 测试大容量背包 - 大重量大价值时 Pareto 与分支限界一致
+TEST(LargeKnapsackTest, ParetoMatchesBranchAndBound) {
+    std::mt19937_64 gen(431);
+    for (int round = 0; round < 30; round++) {
+        std::size_t n = 1 + gen() % 20;
+        std::vector<long long> weights(n), values(n);
+        long long total = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            weights[i] = 1000000000LL + static_cast<long long>(gen() % 9000000000ULL);
+            values[i] = 1000000000LL + static_cast<long long>(gen() % 1000000000000ULL);
+            total += weights[i];
+        }
+        long long capacity = total / 2;
+
+        auto pareto = algorithms::knapsack01Large(weights, values, capacity, algorithms::KnapsackSolver::Pareto);
+        auto bnb = algorithms::knapsack01Large(weights, values, capacity,
+                                               algorithms::KnapsackSolver::BranchAndBound);
+        EXPECT_EQ(pareto.maxValue, bnb.maxValue);
+        EXPECT_EQ(checkLargeSolution(weights, values, capacity, pareto), pareto.maxValue);
+        EXPECT_EQ(checkLargeSolution(weights, values, capacity, bnb), bnb.maxValue);
+        EXPECT_EQ(algorithms::selectKnapsackSolver(weights, values, capacity), algorithms::KnapsackSolver::Pareto);
+    }
+}
+
+// 测试大容量背包 - 几百个物品时自动选择分支限界
+TEST(LargeKnapsackTest, HundredsOfItemsUseBranchAndBound) {
+    std::mt19937_64 gen(432);
+    std::vector<long long> weights(300), values(300);
+    for (std::size_t i = 0; i < weights.size(); i++) {
+        weights[i] = 1000000 + static_cast<long long>(gen() % 1000000000ULL);
+        values[i] = weights[i] / 1000 + static_cast<long long>(gen() % 1000000ULL);
+    }
+    long long capacity = 20000000000LL;
+
+    EXPECT_EQ(algorithms::selectKnapsackSolver(weights, values, capacity),
+              algorithms::KnapsackSolver::BranchAndBound);
+    auto solution = algorithms::knapsack01Large(weights, values, capacity);
+    EXPECT_EQ(checkLargeSolution(weights, values, capacity, solution), solution.maxValue);
+    EXPECT_GT(solution.maxValue, 0);
+}
+
+// 测试大容量背包 - 重量等于价值的困难实例，Auto 在搜索预算内给出接近最优的解
+TEST(LargeKnapsackTest, AutoFinishesOnHardSubsetSum) {
+    std::mt19937_64 gen(433);
+    std::vector<long long> weights(200);
+    long long total = 0;
+    for (long long& weight : weights) {
+        weight = 100000000LL + static_cast<long long>(gen() % 100000001ULL);
+        total += weight;
+    }
+    long long capacity = total / 2 + 1;
+
+    EXPECT_EQ(algorithms::selectKnapsackSolver(weights, weights, capacity),
+              algorithms::KnapsackSolver::BranchAndBound);
+    auto solution = algorithms::knapsack01Large(weights, weights, capacity);
+    EXPECT_EQ(checkLargeSolution(weights, weights, capacity, solution), solution.maxValue);
+    // 最优值不超过容量；缩放 DP 的损失远小于百万分之一
+    EXPECT_LE(solution.maxValue, capacity);
+    EXPECT_GE(solution.maxValue, capacity - capacity / 1000000);
+}
+
+// 测试大容量背包 - 几十万个物品时分支限界不会耗尽调用栈
+TEST(LargeKnapsackTest, ManyItemsSearchIteratively) {
+    std::mt19937_64 gen(434);
+    std::vector<long long> weights(200000), values(200000);
+    long long total = 0;
+    for (std::size_t i = 0; i < weights.size(); i++) {
+        weights[i] = 1 + static_cast<long long>(gen() % 1000000000ULL);
+        values[i] = 1 + static_cast<long long>(gen() % 1000000000ULL);
+        total += weights[i];
+    }
+    long long capacity = total / 2;
+
+    auto solution = algorithms::knapsack01Large(weights, values, capacity);
+    EXPECT_EQ(checkLargeSolution(weights, values, capacity, solution), solution.maxValue);
+    EXPECT_GT(solution.selectedItems.size(), weights.size() / 2);
+}
+
+// 测试大容量背包 - 零重量物品与非法输入
+TEST(LargeKnapsackTest, EdgeCasesAndInvalidInput) {
+    auto solution = algorithms::knapsack01Large({0, 5, 0}, {3, 10, -1}, 0);
+    EXPECT_EQ(solution.maxValue, 3);
+    EXPECT_EQ(solution.selectedItems, (std::vector<int>{0}));
+    EXPECT_EQ(algorithms::knapsack01Large({}, {}, 1000000000000LL).maxValue, 0);
+
+    EXPECT_THROW(algorithms::knapsack01Large({1}, {1, 2}, 10), std::invalid_argument);
+    EXPECT_THROW(algorithms::knapsack01Large({1}, {1}, -1), std::invalid_argument);
+    EXPECT_THROW(algorithms::knapsack01Large({-1}, {1}, 10), std::invalid_argument);
+    EXPECT_THROW(algorithms::knapsack01Large({1, 1}, {LLONG_MAX, 1}, 10), std::invalid_argument);
+}
+
+// ========== 新增：子集和测试 ==========
+
+// 测试子集和 - 基本示例
+TEST(SubsetSumTest, BasicFeasibility) {
+    std::vector<int> weights = {3, 34, 4, 12, 5, 2};
+    EXPECT_TRUE(algorithms::subsetSum(weights, 9));
+    EXPECT_FALSE(algorithms::subsetSum(weights, 30));
+    EXPECT_TRUE(algorithms::subsetSum(weights, 0));
+    EXPECT_TRUE(algorithms::subsetSum(weights, 60));
+    EXPECT_FALSE(algorithms::subsetSum(weights, 61));
+    EXPECT_FALSE(algorithms::subsetSum({}, 1));
+
+    EXPECT_EQ(algorithms::closestSubsetSum({6, 9, 14}, 22), 20);
+    EXPECT_EQ(algorithms::closestSubsetSum({6, 9, 14}, 5), 0);
+    EXPECT_EQ(algorithms::closestSubsetSum({0, 100}, 99), 0);
+}
+
+// 测试子集和 - 非法输入
+TEST(SubsetSumTest, InvalidInput) {
+    EXPECT_THROW(algorithms::subsetSum({1, 2}, -1), std::invalid_argument);
+    EXPECT_THROW(algorithms::subsetSum({1, -2}, 3), std::invalid_argument);
+    EXPECT_THROW(algorithms::closestSubsetSum({1}, -5), std::invalid_argument);
+}
+
+// 测试子集和 - 与 knapsack01（价值等于重量）结果一致
+TEST(SubsetSumTest, MatchesKnapsack) {
+    std::mt19937 gen(44);
+    for (int round = 0; round < 100; round++) {
+        int n = static_cast<int>(gen() % 20);
+        int capacity = static_cast<int>(gen() % 3000);
+        std::vector<int> weights(n);
+        for (int& w : weights) w = static_cast<int>(gen() % 700);
+
+        int best = algorithms::knapsack01(weights, weights, capacity);
+        EXPECT_EQ(algorithms::closestSubsetSum(weights, capacity), best);
+        EXPECT_TRUE(algorithms::subsetSum(weights, best));
+        if (best < capacity) {
+            EXPECT_FALSE(algorithms::subsetSum(weights, capacity));
+        }
+    }
+}
+
+// 测试子集和 - 位集移位内核在各指令集级别下结果一致
+TEST(SubsetSumTest, ShiftKernelLevelsAgree) {
+    std::mt19937_64 gen(441);
+    for (std::size_t words : {1u, 4u, 5u, 9u, 37u}) {
+        for (std::size_t shift : {0u, 1u, 63u, 64u, 65u, 130u, 257u, 2000u}) {
+            std::vector<std::uint64_t> original(words);
+            for (auto& w : original) w = gen() & gen();
+
+            // 朴素逐位计算的参考结果
+            std::vector<std::uint64_t> expected = original;
+            for (std::size_t bit = words * 64; bit-- > shift;) {
+                std::size_t from = bit - shift;
+                if ((original[from / 64] >> (from % 64)) & 1) {
+                    expected[bit / 64] |= std::uint64_t(1) << (bit % 64);
+                }
+            }
+
+            for (auto level : {algorithms::detail::SimdLevel::Scalar, algorithms::detail::SimdLevel::AVX2}) {
+                std::vector<std::uint64_t> actual = original;
+                algorithms::detail::shiftOrBitset(actual.data(), words, shift, level);
+                EXPECT_EQ(actual, expected) << "words=" << words << " shift=" << shift;
+            }
+        }
+    }
+}
+
+// 测试背包向量内核 - 各指令集级别的 32/64 位行更新与选择位图与朴素实现一致
+TEST(KnapsackKernelTest, RelaxLevelsAgree) {
+    using algorithms::detail::SimdLevel;
+    std::mt19937_64 gen(451);
+    for (std::size_t capacity : {0u, 1u, 7u, 15u, 16u, 63u, 64u, 100u, 257u, 1000u}) {
+        for (std::size_t weight : {0u, 1u, 2u, 3u, 4u, 7u, 8u, 9u, 16u, 17u, 63u, 64u, 300u}) {
+            if (weight > capacity) continue;
+            std::vector<std::int64_t> original(capacity + 1);
+            for (auto& v : original) v = static_cast<std::int64_t>(gen() % 100000);
+            std::int64_t value = static_cast<std::int64_t>(gen() % 50000);
+            std::size_t rowWords = (capacity + 64) / 64;
+
+            std::vector<std::int64_t> expected = original;
+            std::vector<std::uint64_t> expectedTaken(rowWords, 0);
+            for (std::size_t w = capacity + 1; w-- > weight;) {
+                if (original[w - weight] + value > original[w]) {
+                    expected[w] = original[w - weight] + value;
+                    expectedTaken[w / 64] |= std::uint64_t(1) << (w % 64);
+                }
+            }
+
+            for (auto level : {SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512}) {
+                std::vector<std::int64_t> wide = original;
+                std::vector<std::uint64_t> taken(rowWords, 0);
+                algorithms::detail::knapsackRelax(wide.data(), capacity, weight, value, taken.data(), level);
+                EXPECT_EQ(wide, expected) << "capacity=" << capacity << " weight=" << weight;
+                EXPECT_EQ(taken, expectedTaken) << "capacity=" << capacity << " weight=" << weight;
+
+                std::vector<std::int32_t> narrow(original.begin(), original.end());
+                std::fill(taken.begin(), taken.end(), 0);
+                algorithms::detail::knapsackRelax(narrow.data(), capacity, weight,
+                                                  static_cast<std::int32_t>(value), taken.data(), level);
+                EXPECT_TRUE(std::equal(narrow.begin(), narrow.end(), expected.begin()))
+                    << "capacity=" << capacity << " weight=" << weight;
+                EXPECT_EQ(taken, expectedTaken) << "capacity=" << capacity << " weight=" << weight;
+            }
+        }
+    }
+}
+
+// 测试大容量背包 - 按容量 DP 的总价值超出 int 范围
+TEST(LargeKnapsackTest, CapacityDPWideValues) {
+    std::vector<long long> weights = {3, 4, 5, 6, 7};
+    std::vector<long long> values = {4000000000LL, 5000000000LL, 6000000000LL, 7000000000LL, 8000000000LL};
+    auto solution = algorithms::knapsack01Large(weights, values, 13, algorithms::KnapsackSolver::CapacityDP);
+    EXPECT_EQ(solution.maxValue, 16000000000LL);
+    long long weight = 0, value = 0;
+    for (int i : solution.selectedItems) {
+        weight += weights[i];
+        value += values[i];
+    }
+    EXPECT_LE(weight, 13);
+    EXPECT_EQ(value, solution.maxValue);
+}
+
+namespace {
+
+// 朴素 O(m·n) 的 LCS 长度，作为位并行实现的参考
+int naiveLcsLength(const std::string& a, const std::string& b) {
+    std::vector<int> prev(b.size() + 1, 0), cur(b.size() + 1, 0);
+    for (std::size_t i = 1; i <= a.size(); i++) {
+        for (std::size_t j = 1; j <= b.size(); j++) {
+            cur[j] = a[i - 1] == b[j - 1] ? prev[j - 1] + 1 : std::max(prev[j], cur[j - 1]);
+        }
+        std::swap(prev, cur);
+    }
+    return prev[b.size()];
+}
+
+std::string randomString(std::mt19937_64& gen, std::size_t length, int alphabet) {
+    std::string s(length, 'a');
+    for (char& c : s) c = static_cast<char>('a' + static_cast<int>(gen() % alphabet));
+    return s;
+}
+
+} // namespace
+
+// 测试最长公共子序列 - 位并行实现与朴素DP一致（跨越多个机器字）
+TEST(LongestCommonSubsequenceTest, BitParallelMatchesNaive) {
+    std::mt19937_64 gen(461);
+    for (int round = 0; round < 200; round++) {
+        std::size_t m = gen() % 300;
+        std::size_t n = gen() % 300;
+        int alphabet = 1 + static_cast<int>(gen() % 26);
+        std::string a = randomString(gen, m, alphabet);
+        std::string b = randomString(gen, n, alphabet);
+        ASSERT_EQ(algorithms::longestCommonSubsequence(a, b), naiveLcsLength(a, b))
+            << "m=" << m << " n=" << n << " alphabet=" << alphabet;
+    }
+}
+
+// 测试最长公共子序列 - 字长边界、全部相同字符与任意字节
+TEST(LongestCommonSubsequenceTest, WordBoundariesAndBytes) {
+    for (std::size_t n : {63u, 64u, 65u, 127u, 128u, 129u}) {
+        std::string same(n, 'x');
+        EXPECT_EQ(algorithms::longestCommonSubsequence(same, same), static_cast<int>(n));
+        EXPECT_EQ(algorithms::longestCommonSubsequence(same, std::string(n, 'y')), 0);
+        EXPECT_EQ(algorithms::longestCommonSubsequence(same + "y", same.substr(1)), static_cast<int>(n - 1));
+    }
+
+    std::string bytes;
+    for (int c = 0; c < 256; c++) bytes.push_back(static_cast<char>(c));
+    std::string reversed(bytes.rbegin(), bytes.rend());
+    EXPECT_EQ(algorithms::longestCommonSubsequence(bytes, bytes), 256);
+    EXPECT_EQ(algorithms::longestCommonSubsequence(bytes, reversed), 1);
+}
+
+// 测试位并行LCS内核 - 斜排 AVX2 与标量逐行推进的状态一致（含不足 4 个的剩余字与跨行块）
+TEST(LongestCommonSubsequenceTest, AdvanceLevelsAgree) {
+    using algorithms::detail::SimdLevel;
+    std::mt19937_64 gen(465);
+    for (std::size_t n : {512u, 575u, 640u, 700u, 1000u, 2047u}) {
+        for (std::size_t m : {16u, 17u, 255u, 256u, 257u, 600u}) {
+            int alphabet = 1 + static_cast<int>(gen() % 8);
+            std::string columns = randomString(gen, n, alphabet);
+            std::string rows = randomString(gen, m, alphabet + 1);  // 多出的字符不在列串中
+            algorithms::detail::BitParallelLcs lcs(columns);
+
+            std::vector<std::uint64_t> scalar(lcs.words(), ~std::uint64_t(0));
+            std::vector<std::uint64_t> avx2 = scalar;
+            lcs.advance(scalar.data(), lcs.words(), rows, SimdLevel::Scalar);
+            lcs.advance(avx2.data(), lcs.words(), rows, SimdLevel::AVX2);
+            ASSERT_EQ(avx2, scalar) << "n=" << n << " m=" << m;
+            EXPECT_EQ(static_cast<int>(lcs.lengthFromState(avx2.data())), naiveLcsLength(rows, columns)) << "n=" << n << " m=" << m;
+        }
+    }
+}
+
+namespace {
+
+// 完整 DP 表回溯的参考实现（与原实现的回溯规则相同）
+std::string naiveLcsString(const std::string& a, const std::string& b) {
+    std::vector<std::vector<int>> dp(a.size() + 1, std::vector<int>(b.size() + 1, 0));
+    for (std::size_t i = 1; i <= a.size(); i++) {
+        for (std::size_t j = 1; j <= b.size(); j++) {
+            dp[i][j] = a[i - 1] == b[j - 1] ? dp[i - 1][j - 1] + 1 : std::max(dp[i - 1][j], dp[i][j - 1]);
+        }
+    }
+    std::string lcs;
+    std::size_t i = a.size(), j = b.size();
+    while (i > 0 && j > 0) {
+        if (a[i - 1] == b[j - 1]) {
+            lcs.push_back(a[i - 1]);
+            i--;
+            j--;
+        } else if (dp[i - 1][j] > dp[i][j - 1]) {
+            i--;
+        } else {
+            j--;
+        }
+    }
+    return std::string(lcs.rbegin(), lcs.rend());
+}
+
+bool isSubsequence(const std::string& sub, const std::string& s) {
+    std::size_t k = 0;
+    for (char c : s) {
+        if (k < sub.size() && sub[k] == c) k++;
+    }
+    return k == sub.size();
+}
+
+} // namespace
+
+// 测试获取LCS - 线性空间回溯与完整DP表回溯的结果逐字相同
+TEST(GetLongestCommonSubsequenceTest, MatchesFullTableBacktrack) {
+    std::mt19937_64 gen(471);
+    for (int round = 0; round < 150; round++) {
+        std::size_t m = gen() % 200;
+        std::size_t n = gen() % 200;
+        int alphabet = 1 + static_cast<int>(gen() % 8);
+        std::string a = randomString(gen, m, alphabet);
+        std::string b = randomString(gen, n, alphabet);
+        ASSERT_EQ(algorithms::getLongestCommonSubsequence(a, b), naiveLcsString(a, b))
+            << "a=" << a << " b=" << b;
+    }
+}
+
+// 测试获取LCS - 行数足够多时走按行二分的路径
+TEST(GetLongestCommonSubsequenceTest, RecursiveSplitMatchesFullTable) {
+    std::mt19937_64 gen(472);
+    for (int alphabet : {2, 4, 26}) {
+        std::string a = randomString(gen, 3000, alphabet);
+        std::string b = randomString(gen, 1500, alphabet);
+        EXPECT_EQ(algorithms::getLongestCommonSubsequence(a, b), naiveLcsString(a, b));
+    }
+}
+
+// 测试获取LCS - 大输入只占线性内存，结果是两者的公共子序列且长度最优
+TEST(GetLongestCommonSubsequenceTest, LargeInputs) {
+    std::mt19937_64 gen(473);
+    std::string a = randomString(gen, 20000, 4);
+    std::string b = a;
+    for (int k = 0; k < 500; k++) b[gen() % b.size()] = static_cast<char>('a' + gen() % 4);
+    b.erase(gen() % b.size(), 300);
+
+    std::string lcs = algorithms::getLongestCommonSubsequence(a, b);
+    EXPECT_EQ(static_cast<int>(lcs.size()), algorithms::longestCommonSubsequence(a, b));
+    EXPECT_TRUE(isSubsequence(lcs, a));
+    EXPECT_TRUE(isSubsequence(lcs, b));
+}
+
+// 测试编辑距离 - 基本用例与空串
+TEST(EditDistanceTest, BasicFunctionality) {
+    EXPECT_EQ(algorithms::editDistance("kitten", "sitting"), 3);
+    EXPECT_EQ(algorithms::editDistance("flaw", "lawn"), 2);
+    EXPECT_EQ(algorithms::editDistance("", ""), 0);
+    EXPECT_EQ(algorithms::editDistance("", "abc"), 3);
+    EXPECT_EQ(algorithms::editDistance("abc", ""), 3);
+    EXPECT_EQ(algorithms::editDistance("same", "same"), 0);
+}
+
+// 测试编辑距离 - 与完整DP表一致且对称
+TEST(EditDistanceTest, MatchesFullTable) {
+    std::mt19937_64 gen(481);
+    for (int round = 0; round < 100; round++) {
+        std::string a = randomString(gen, gen() % 80, 1 + static_cast<int>(gen() % 5));
+        std::string b = randomString(gen, gen() % 80, 1 + static_cast<int>(gen() % 5));
+
+        std::vector<std::vector<int>> dp(a.size() + 1, std::vector<int>(b.size() + 1, 0));
+        for (std::size_t i = 0; i <= a.size(); i++) dp[i][0] = static_cast<int>(i);
+        for (std::size_t j = 0; j <= b.size(); j++) dp[0][j] = static_cast<int>(j);
+        for (std::size_t i = 1; i <= a.size(); i++) {
+            for (std::size_t j = 1; j <= b.size(); j++) {
+                dp[i][j] = std::min({dp[i - 1][j - 1] + (a[i - 1] != b[j - 1] ? 1 : 0),
+                                     dp[i - 1][j] + 1, dp[i][j - 1] + 1});
+            }
+        }
+        EXPECT_EQ(algorithms::editDistance(a, b), dp[a.size()][b.size()]);
+        EXPECT_EQ(algorithms::editDistance(b, a), dp[a.size()][b.size()]);
+    }
+}
@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+#include "algorithms/fm_index.h"
+#include "algorithms/string_algorithms.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using algorithms::FMIndex;
+
+namespace {
+
+std::vector<std::size_t> toSizeT(const std::vector<int>& positions) {
+    return std::vector<std::size_t>(positions.begin(), positions.end());
+}
+
+// 按近似 Zipf 分布抽取常用词拼成的英文文本，夹杂大写、标点、数字和 UTF-8 字符
+std::string englishLikeText(std::size_t length, unsigned seed) {
+    static const char* const words[] = {
+        "the", "of", "and", "to", "in", "a", "is", "that", "for", "it", "as", "was", "with", "be", "by",
+        "on", "not", "he", "this", "are", "or", "his", "from", "at", "which", "but", "have", "an", "had",
+        "they", "you", "were", "their", "one", "all", "we", "can", "her", "has", "there", "been", "if",
+        "more", "when", "will", "would", "who", "so", "no", "index", "search", "pattern", "text", "query",
+        "memory", "compressed", "suffix", "array", "wavelet", "tree", "rank", "select", "number", "value"};
+    static const char* const extras[] = {", ", ". ", "; ", "\n", " (", ") ", " - ", " 42 ", " caf\xc3\xa9 ",
+                                         " \xe2\x80\x94 ", "\"", "? "};
+    std::mt19937 gen(seed);
+    std::size_t count = sizeof(words) / sizeof(words[0]);
+    std::string text;
+    bool capitalize = true;
+    while (text.size() < length) {
+        // 第 k 个词的概率约与 1/(k+1) 成正比
+        std::size_t k = static_cast<std::size_t>(std::pow(count + 1.0, std::generate_canonical<double, 32>(gen))) - 1;
+        std::string word = words[std::min(k, count - 1)];
+        if (capitalize) word[0] = static_cast<char>(word[0] - 'a' + 'A');
+        text += word;
+        capitalize = false;
+        if (gen() % 6 == 0) {
+            std::string extra = extras[gen() % (sizeof(extras) / sizeof(extras[0]))];
+            text += extra;
+            capitalize = extra == ". " || extra == "? ";
+        } else {
+            text += ' ';
+        }
+    }
+    text.resize(length);
+    return text;
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string& path, const std::string& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+void setWord(std::string& bytes, std::size_t index, std::uint64_t value) {
+    std::memcpy(&bytes[index * sizeof(value)], &value, sizeof(value));
+}
+
+std::uint64_t getWord(const std::string& bytes, std::size_t index) {
+    std::uint64_t value;
+    std::memcpy(&value, &bytes[index * sizeof(value)], sizeof(value));
+    return value;
+}
+
+} // namespace
+
+// 测试FM索引 - 计数与定位
+TEST(FMIndexTest, CountAndLocate) {
+    FMIndex index("abracadabra");
+    EXPECT_EQ(index.textLength(), 11u);
+    EXPECT_EQ(index.alphabetSize(), 5u);
+
+    EXPECT_EQ(index.count("abra"), 2u);
+    EXPECT_EQ(index.locate("abra"), (std::vector<std::size_t>{0, 7}));
+    EXPECT_EQ(index.count("a"), 5u);
+    EXPECT_EQ(index.locate("a"), (std::vector<std::size_t>{0, 3, 5, 7, 10}));
+    EXPECT_EQ(index.count("abracadabra"), 1u);
+    EXPECT_EQ(index.count("abrax"), 0u);
+    EXPECT_EQ(index.count("z"), 0u);
+    EXPECT_EQ(index.count(""), 0u);
+    EXPECT_TRUE(index.locate("cab").empty());
+}
+
+// 测试FM索引 - 空文本与单字符文本
+TEST(FMIndexTest, TinyTexts) {
+    FMIndex empty("");
+    EXPECT_EQ(empty.count("a"), 0u);
+    EXPECT_TRUE(empty.locate("a").empty());
+
+    FMIndex single(std::string(100, 'x'), 7);
+    EXPECT_EQ(single.alphabetSize(), 1u);
+    EXPECT_EQ(single.count("xx"), 99u);
+    std::vector<std::size_t> positions = single.locate(std::string(98, 'x'));
+    EXPECT_EQ(positions, (std::vector<std::size_t>{0, 1, 2}));
+
+    EXPECT_THROW(FMIndex("abc", 0), std::invalid_argument);
+}
+
+// 测试FM索引 - 随机文本与 kmpSearch 对比（不同字母表大小和采样间隔）
+TEST(FMIndexTest, MatchesKmpOnRandomText) {
+    std::mt19937 gen(39);
+    for (int alphabet : {2, 4, 20, 256}) {
+        std::uniform_int_distribution<int> byte(0, alphabet - 1);
+        std::string text(4000, ' ');
+        for (char& c : text) c = static_cast<char>(byte(gen));
+
+        for (std::size_t rate : {1u, 5u, 32u}) {
+            FMIndex index(text, rate);
+            for (int q = 0; q < 30; q++) {
+                std::size_t start = gen() % text.size();
+                std::size_t len = 1 + gen() % std::min<std::size_t>(6, text.size() - start);
+                std::string pattern = text.substr(start, len);
+                if (q % 5 == 0) pattern.back() = static_cast<char>(byte(gen));
+
+                std::vector<int> expected = algorithms::kmpSearch(text, pattern);
+                EXPECT_EQ(index.count(pattern), expected.size());
+                EXPECT_EQ(index.locate(pattern), toSizeT(expected));
+            }
+        }
+    }
+}
+
+// 测试FM索引 - 小字母表的索引比原文本小
+TEST(FMIndexTest, SmallerThanTextForSmallAlphabet) {
+    std::mt19937 gen(391);
+    const char bases[] = {'A', 'C', 'G', 'T'};
+    std::string dna(100000, ' ');
+    for (char& c : dna) c = bases[gen() % 4];
+
+    FMIndex index(dna, 64);
+    EXPECT_EQ(index.alphabetSize(), 4u);
+    // 小波树 2 位/字符 + 采样标记约 1 位/字符，加上采样后缀数组 0.5 位/字符
+    EXPECT_LT(index.sizeInBytes(), dna.size() * 6 / 10);
+}
+
+// 测试FM索引 - 英文文本在默认采样间隔下少于 8 位/字符
+TEST(FMIndexTest, SmallerThanTextForEnglish) {
+    std::string text = englishLikeText(300000, 392);
+    FMIndex index(text);
+    EXPECT_GT(index.alphabetSize(), 50u);
+    // Huffman 小波树约 H0 ≈ 4.5 位/字符，采样标记约 1 位/字符，采样后缀数组 1 位/字符
+    EXPECT_LT(index.sizeInBytes() * 8, text.size() * 7);
+
+    for (const std::string& pattern : {"the ", "Index", "caf\xc3\xa9", "rank select", "\n", "zzz"}) {
+        std::vector<std::size_t> expected = toSizeT(algorithms::kmpSearch(text, pattern));
+        EXPECT_EQ(index.count(pattern), expected.size()) << pattern;
+        EXPECT_EQ(index.locate(pattern), expected) << pattern;
+    }
+}
+
+// 测试FM索引 - 保存、加载与内存映射
+TEST(FMIndexTest, SaveLoadAndMap) {
+    std::string text = "mississippi river mississippi";
+    std::string path = ::testing::TempDir() + "fm_index.fmi";
+    FMIndex original(text, 4);
+    original.save(path);
+
+    FMIndex loaded = FMIndex::load(path);
+    FMIndex mapped = FMIndex::map(path);
+    EXPECT_EQ(loaded.sizeInBytes(), original.sizeInBytes());
+    for (const std::string& pattern : {"ssi", "mississippi", "r", " ", "ppi r", "xyz"}) {
+        std::vector<std::size_t> expected = toSizeT(algorithms::kmpSearch(text, pattern));
+        EXPECT_EQ(loaded.locate(pattern), expected) << pattern;
+        EXPECT_EQ(mapped.locate(pattern), expected) << pattern;
+        EXPECT_EQ(mapped.count(pattern), expected.size());
+    }
+
+    // 移动后仍然可用
+    FMIndex moved = std::move(mapped);
+    EXPECT_EQ(moved.count("ss"), 4u);
+    std::remove(path.c_str());
+}
+
+// 测试FM索引 - 加载错误的文件
+TEST(FMIndexTest, LoadInvalidFile) {
+    EXPECT_THROW(FMIndex::load(::testing::TempDir() + "missing.fmi"), std::runtime_error);
+
+    std::string path = ::testing::TempDir() + "bad.fmi";
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "definitely not an fm index";
+    }
+    EXPECT_THROW(FMIndex::load(path), std::runtime_error);
+    EXPECT_THROW(FMIndex::map(path), std::runtime_error);
+
+    // 截断一个字的文件
+    FMIndex("banana").save(path);
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 8));
+    }
+    EXPECT_THROW(FMIndex::load(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+// 测试FM索引 - 头部的累计计数和小波树结点表损坏时拒绝加载
+TEST(FMIndexTest, LoadCorruptHeader) {
+    std::string path = ::testing::TempDir() + "corrupt.fmi";
+    FMIndex("mississippi").save(path);
+    const std::string original = readFile(path);
+
+    // 文件头：第 264 字起是累计计数 C[0..σ]，第 521 字起是 σ 个码字，之后每个内部结点两个字
+    const std::size_t counts = 264;
+    const std::size_t sigma = 4;
+    const std::size_t nodes = 521 + sigma;
+    struct Corruption {
+        std::size_t word;
+        std::uint64_t value;
+    };
+    const Corruption corruptions[] = {
+        {counts, 0},                                           // C[0] 必须为 1
+        {counts + 2, getWord(original, counts + 3) + 5},       // C 不再递增
+        {counts + sigma, 1000},                                // C[σ] 超过行数
+        {521, getWord(original, 521) + 1},                     // 码长与树不符
+        {nodes + 2, 1},                                        // 第二个结点的起点错位
+        {nodes + 1, 0x8000000780000007ULL},                    // 叶子编码越界
+        {nodes + 1, 0},                                        // 孩子指回根结点
+        {6, getWord(original, 6) + 64},                        // 树的总位数不符
+        {7, 100},                                              // 采样个数不符
+    };
+    for (const Corruption& corruption : corruptions) {
+        std::string bytes = original;
+        setWord(bytes, corruption.word, corruption.value);
+        writeFile(path, bytes);
+        EXPECT_THROW(FMIndex::load(path), std::runtime_error) << corruption.word;
+        EXPECT_THROW(FMIndex::map(path), std::runtime_error) << corruption.word;
+    }
+
+    // 任意改写头部的一个字：要么拒绝加载，要么查询仍然只访问文件内的数据
+    std::size_t headerWords = nodes + 2 * (sigma - 1);
+    for (std::size_t word = 0; word < headerWords; word++) {
+        for (std::uint64_t delta : {std::uint64_t(1), std::uint64_t(1) << 40, ~std::uint64_t(0)}) {
+            std::string bytes = original;
+            setWord(bytes, word, getWord(original, word) + delta);
+            writeFile(path, bytes);
+            try {
+                FMIndex index = FMIndex::load(path);
+                index.count("ssi");
+                index.locate("i");
+            } catch (const std::runtime_error&) {
+            }
+        }
+    }
+    std::remove(path.c_str());
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "algorithms/learned_index.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using algorithms::search::PiecewiseLinearIndex;
+
+// 测试学习索引 - 基本查找
+TEST(PiecewiseLinearIndexTest, FindTarget) {
+    std::vector<int> keys = {1, 2, 3, 10, 20, 30, 1000, 2000};
+    PiecewiseLinearIndex index(keys, 2);
+
+    EXPECT_EQ(index.find(1), 0);
+    EXPECT_EQ(index.find(20), 4);
+    EXPECT_EQ(index.find(2000), 7);
+    EXPECT_EQ(index.find(0), -1);
+    EXPECT_EQ(index.find(15), -1);
+    EXPECT_EQ(index.find(3000), -1);
+}
+
+// 测试学习索引 - lowerBound 语义
+TEST(PiecewiseLinearIndexTest, LowerBound) {
+    std::vector<int> keys = {1, 2, 3, 10, 20, 30, 1000, 2000};
+    PiecewiseLinearIndex index(keys, 2);
+
+    EXPECT_EQ(index.lowerBound(-5), 0u);
+    EXPECT_EQ(index.lowerBound(15), 4u);
+    EXPECT_EQ(index.lowerBound(30), 5u);
+    EXPECT_EQ(index.lowerBound(2001), keys.size());
+}
+
+// 测试学习索引 - 空数组
+TEST(PiecewiseLinearIndexTest, EmptyArray) {
+    std::vector<int> keys;
+    PiecewiseLinearIndex index(keys);
+
+    EXPECT_EQ(index.find(5), -1);
+    EXPECT_EQ(index.lowerBound(5), 0u);
+    EXPECT_EQ(index.segmentCount(), 0u);
+}
+
+// 测试学习索引 - 非法误差上界
+TEST(PiecewiseLinearIndexTest, InvalidEpsilonThrows) {
+    std::vector<int> keys = {1, 2, 3};
+    EXPECT_THROW(PiecewiseLinearIndex(keys, 0), std::invalid_argument);
+    EXPECT_THROW(PiecewiseLinearIndex(keys, -4), std::invalid_argument);
+}
+
+// 测试学习索引 - 重复元素返回首次出现位置
+TEST(PiecewiseLinearIndexTest, DuplicateElements) {
+    std::vector<int> keys;
+    for (int i = 0; i < 1000; i++) keys.push_back(5);
+    for (int i = 0; i < 1000; i++) keys.push_back(7);
+    keys.push_back(9);
+    PiecewiseLinearIndex index(keys, 4);
+
+    EXPECT_EQ(index.find(5), 0);
+    EXPECT_EQ(index.find(7), 1000);
+    EXPECT_EQ(index.find(9), 2000);
+    EXPECT_EQ(index.lowerBound(6), 1000u);
+    EXPECT_EQ(index.lowerBound(8), 2000u);
+}
+
+// 测试学习索引 - 分段均匀数据：段数少且误差不超过上界
+TEST(PiecewiseLinearIndexTest, PiecewiseUniformData) {
+    std::vector<int> keys;
+    int value = 0;
+    for (int segment = 0; segment < 10; segment++) {
+        int stride = (segment % 2 == 0) ? 3 : 1000;
+        for (int i = 0; i < 10000; i++) {
+            keys.push_back(value);
+            value += stride;
+        }
+    }
+    PiecewiseLinearIndex index(keys, 16);
+
+    EXPECT_LE(index.segmentCount(), 20u);
+    EXPECT_LE(index.maxError(), index.epsilon());
+    EXPECT_LT(index.modelSizeBytes(), keys.size() * sizeof(int) / 100);
+
+    for (std::size_t i = 0; i < keys.size(); i += 97) {
+        EXPECT_EQ(index.find(keys[i]), static_cast<int>(i));
+    }
+}
+
+// 测试学习索引 - 偏斜随机数据与 std::lower_bound 结果一致
+TEST(PiecewiseLinearIndexTest, MatchesStdLowerBoundOnSkewedData) {
+    std::mt19937 gen(42);
+    std::exponential_distribution<double> dist(1e-4);
+    std::vector<int> keys(50000);
+    for (int& k : keys) k = static_cast<int>(dist(gen));
+    std::sort(keys.begin(), keys.end());
+
+    PiecewiseLinearIndex index(keys, 8);
+    EXPECT_LE(index.maxError(), 8);
+
+    std::uniform_int_distribution<int> query(-10, keys.back() + 10);
+    for (int q = 0; q < 20000; q++) {
+        int target = query(gen);
+        auto expected = std::lower_bound(keys.begin(), keys.end(), target) - keys.begin();
+        ASSERT_EQ(index.lowerBound(target), static_cast<std::size_t>(expected)) << "target=" << target;
+    }
+}
+
+// 测试学习索引 - 不能由临时数组构造（索引不持有数据）
+TEST(PiecewiseLinearIndexTest, RejectsTemporaryKeys) {
+    static_assert(!std::is_constructible<PiecewiseLinearIndex, std::vector<int>&&>::value,
+                  "临时数组构造的索引会立即悬空");
+    static_assert(!std::is_constructible<PiecewiseLinearIndex, std::vector<int>&&, int>::value,
+                  "临时数组构造的索引会立即悬空");
+    static_assert(std::is_constructible<PiecewiseLinearIndex, std::vector<int>&, int>::value,
+                  "左值数组应当可以构造索引");
+    SUCCEED();
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "algorithms/mapped_search.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using algorithms::search::MappedSortedArray;
+
+namespace {
+
+// 辅助函数：按小端序把键写入临时文件，返回文件路径
+template<typename T>
+std::string writeKeys(const std::string& name, const std::vector<T>& keys) {
+    std::string path = ::testing::TempDir() + name;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    for (T key : keys) {
+        auto value = static_cast<typename std::make_unsigned<T>::type>(key);
+        for (std::size_t b = 0; b < sizeof(T); b++) {
+            out.put(static_cast<char>((value >> (8 * b)) & 0xFF));
+        }
+    }
+    return path;
+}
+
+} // namespace
+
+// 测试映射数组 - 读取与二分查找
+TEST(MappedSortedArrayTest, BinarySearch) {
+    std::vector<std::int32_t> keys = {-50, -3, 0, 7, 7, 19, 1000, 2000000000};
+    std::string path = writeKeys("mapped_basic.bin", keys);
+    MappedSortedArray<std::int32_t> arr(path);
+
+    ASSERT_EQ(arr.size(), keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        EXPECT_EQ(arr[i], keys[i]);
+    }
+    EXPECT_EQ(arr.binarySearch(-50), 0u);
+    EXPECT_EQ(arr.binarySearch(7), 3u);
+    EXPECT_EQ(arr.binarySearch(2000000000), 7u);
+    EXPECT_EQ(arr.binarySearch(8), (MappedSortedArray<std::int32_t>::npos));
+    EXPECT_EQ(arr.lowerBound(8), 5u);
+    std::remove(path.c_str());
+}
+
+// 测试映射数组 - 空文件
+TEST(MappedSortedArrayTest, EmptyFile) {
+    std::string path = writeKeys("mapped_empty.bin", std::vector<std::uint64_t>{});
+    MappedSortedArray<std::uint64_t> arr(path);
+
+    EXPECT_TRUE(arr.empty());
+    EXPECT_EQ(arr.binarySearch(1), (MappedSortedArray<std::uint64_t>::npos));
+    EXPECT_EQ(arr.interpolationSearch(1), (MappedSortedArray<std::uint64_t>::npos));
+    arr.buildTopLevelIndex();
+    EXPECT_EQ(arr.lowerBound(1), 0u);
+    std::remove(path.c_str());
+}
+
+// 测试映射数组 - 文件不存在或大小不匹配时抛出异常
+TEST(MappedSortedArrayTest, InvalidFileThrows) {
+    EXPECT_THROW(MappedSortedArray<std::int32_t>(::testing::TempDir() + "no_such_file.bin"),
+                 std::runtime_error);
+
+    std::string path = writeKeys("mapped_odd.bin", std::vector<std::uint8_t>{1, 2, 3});
+    EXPECT_THROW(MappedSortedArray<std::uint16_t>{path}, std::invalid_argument);
+    std::remove(path.c_str());
+}
+
+// 测试映射数组 - 顶层索引、插值查找与 std::lower_bound 一致
+TEST(MappedSortedArrayTest, TopLevelIndexMatchesStdLowerBound) {
+    std::mt19937_64 gen(7);
+    std::vector<std::uint64_t> keys(100000);
+    std::uniform_int_distribution<std::uint64_t> dist(0, 1ULL << 40);
+    for (auto& k : keys) k = dist(gen);
+    std::sort(keys.begin(), keys.end());
+    std::string path = writeKeys("mapped_large.bin", keys);
+
+    MappedSortedArray<std::uint64_t> arr(path);
+    arr.adviseRandom();
+    arr.buildTopLevelIndex();
+    ASSERT_TRUE(arr.hasTopLevelIndex());
+    EXPECT_LT(arr.topLevelIndexBytes(), keys.size() * sizeof(std::uint64_t) / 100);
+
+    for (int q = 0; q < 5000; q++) {
+        std::uint64_t target = (q % 2 == 0) ? keys[gen() % keys.size()] : dist(gen);
+        auto expected = static_cast<std::size_t>(
+            std::lower_bound(keys.begin(), keys.end(), target) - keys.begin());
+        ASSERT_EQ(arr.lowerBound(target), expected);
+
+        bool present = expected < keys.size() && keys[expected] == target;
+        std::size_t found = arr.interpolationSearch(target);
+        if (present) {
+            ASSERT_NE(found, (MappedSortedArray<std::uint64_t>::npos));
+            EXPECT_EQ(arr[found], target);
+        } else {
+            EXPECT_EQ(found, (MappedSortedArray<std::uint64_t>::npos));
+        }
+    }
+    EXPECT_EQ(arr.lowerBound(0), 0u);
+    EXPECT_EQ(arr.lowerBound(keys.back() + 1), keys.size());
+    std::remove(path.c_str());
+}
+
+// 测试映射数组 - 小数据块的顶层索引
+TEST(MappedSortedArrayTest, SmallBlocks) {
+    std::vector<std::int16_t> keys;
+    for (int i = -300; i < 300; i += 3) keys.push_back(static_cast<std::int16_t>(i));
+    std::string path = writeKeys("mapped_small.bin", keys);
+
+    MappedSortedArray<std::int16_t> arr(path);
+    arr.buildTopLevelIndex(6);  // 每块3个键
+    for (int t = -305; t < 305; t++) {
+        auto expected = static_cast<std::size_t>(
+            std::lower_bound(keys.begin(), keys.end(), static_cast<std::int16_t>(t)) - keys.begin());
+        ASSERT_EQ(arr.lowerBound(static_cast<std::int16_t>(t)), expected) << "t=" << t;
+    }
+    std::remove(path.c_str());
+}
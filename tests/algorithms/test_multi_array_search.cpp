@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "algorithms/multi_array_search.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using algorithms::search::MultiArraySearcher;
+
+namespace {
+
+// 辅助函数：逐个数组用 std::lower_bound 计算期望结果
+std::vector<std::size_t> naiveLowerBounds(const std::vector<std::vector<int>>& lists, int target) {
+    std::vector<std::size_t> result;
+    for (const auto& list : lists) {
+        result.push_back(static_cast<std::size_t>(
+            std::lower_bound(list.begin(), list.end(), target) - list.begin()));
+    }
+    return result;
+}
+
+std::vector<std::vector<int>> randomLists(std::mt19937& gen, int k, int maxLen, int maxValue) {
+    std::uniform_int_distribution<int> len(0, maxLen);
+    std::uniform_int_distribution<int> value(0, maxValue);
+    std::vector<std::vector<int>> lists(k);
+    for (auto& list : lists) {
+        list.resize(len(gen));
+        for (int& v : list) v = value(gen);
+        std::sort(list.begin(), list.end());
+    }
+    return lists;
+}
+
+} // namespace
+
+// 测试多数组查找 - 基本用例
+TEST(MultiArraySearcherTest, BasicLowerBounds) {
+    MultiArraySearcher searcher({{1, 5, 9}, {2, 4, 6, 8}, {3, 7}});
+
+    EXPECT_EQ(searcher.listCount(), 3u);
+    EXPECT_EQ(searcher.lowerBounds(5), (std::vector<std::size_t>{1, 2, 1}));
+    EXPECT_EQ(searcher.lowerBounds(0), (std::vector<std::size_t>{0, 0, 0}));
+    EXPECT_EQ(searcher.lowerBounds(10), (std::vector<std::size_t>{3, 4, 2}));
+}
+
+// 测试多数组查找 - 空输入与空数组
+TEST(MultiArraySearcherTest, EmptyLists) {
+    MultiArraySearcher none({});
+    EXPECT_TRUE(none.lowerBounds(3).empty());
+
+    MultiArraySearcher searcher({{}, {1, 2}, {}});
+    EXPECT_EQ(searcher.lowerBounds(2), (std::vector<std::size_t>{0, 1, 0}));
+}
+
+// 测试多数组查找 - 未排序输入抛出异常
+TEST(MultiArraySearcherTest, UnsortedInputThrows) {
+    EXPECT_THROW(MultiArraySearcher({{1, 2}, {3, 1}}), std::invalid_argument);
+
+    MultiArraySearcher searcher({{1, 2}, {3, 4}});
+    EXPECT_THROW(searcher.updateList(0, {2, 1}), std::invalid_argument);
+    EXPECT_THROW(searcher.updateList(5, {1}), std::out_of_range);
+}
+
+// 测试多数组查找 - 随机数据（含大量重复）与逐个二分一致
+TEST(MultiArraySearcherTest, MatchesIndependentBinarySearch) {
+    std::mt19937 gen(99);
+    auto lists = randomLists(gen, 24, 300, 500);
+    MultiArraySearcher searcher(lists);
+
+    EXPECT_LE(searcher.augmentedSize(), 2 * 24 * 300u);
+    std::vector<std::size_t> result;
+    for (int target = -2; target <= 502; target++) {
+        searcher.lowerBounds(target, result);
+        ASSERT_EQ(result, naiveLowerBounds(lists, target)) << "target=" << target;
+    }
+}
+
+// 测试多数组查找 - 增量重建
+TEST(MultiArraySearcherTest, UpdateListRebuildsPrefix) {
+    std::mt19937 gen(5);
+    auto lists = randomLists(gen, 10, 100, 1000);
+    MultiArraySearcher searcher(lists);
+
+    for (std::size_t index : {9u, 0u, 4u}) {
+        auto replacement = randomLists(gen, 1, 200, 1000)[0];
+        lists[index] = replacement;
+        searcher.updateList(index, replacement);
+        EXPECT_EQ(searcher.list(index), replacement);
+
+        for (int target = -1; target <= 1001; target += 7) {
+            ASSERT_EQ(searcher.lowerBounds(target), naiveLowerBounds(lists, target))
+                << "index=" << index << " target=" << target;
+        }
+    }
+}
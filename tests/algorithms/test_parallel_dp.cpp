@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "algorithms/parallel_dp.h"
+#include "algorithms/dp_algorithms.h"
+#include <random>
+#include <string>
+
+namespace {
+
+std::string randomText(std::size_t length, char maxLetter, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> letter('a', maxLetter);
+    std::string text(length, ' ');
+    for (char& c : text) c = static_cast<char>(letter(gen));
+    return text;
+}
+
+// 在 text 上做 edits 次随机替换、插入和删除
+std::string mutate(std::string text, std::size_t edits, unsigned seed) {
+    std::mt19937 gen(seed);
+    for (std::size_t k = 0; k < edits && !text.empty(); k++) {
+        std::size_t pos = gen() % text.size();
+        switch (gen() % 3) {
+            case 0: text[pos] = static_cast<char>('a' + gen() % 4); break;
+            case 1: text.insert(pos, 1, static_cast<char>('a' + gen() % 4)); break;
+            default: text.erase(pos, 1); break;
+        }
+    }
+    return text;
+}
+
+} // namespace
+
+// 测试并行DP - 空输入与小输入退化为单线程
+TEST(ParallelDpTest, EmptyAndSmallInputs) {
+    EXPECT_EQ(algorithms::parallelLongestCommonSubsequence("", "abc", 4), 0);
+    EXPECT_EQ(algorithms::parallelLongestCommonSubsequence("ABCDGH", "AEDFHR", 4), 3);
+    EXPECT_EQ(algorithms::parallelEditDistance("", "abc", 4), 3);
+    EXPECT_EQ(algorithms::parallelEditDistance("abcd", "", 4), 4);
+    EXPECT_EQ(algorithms::parallelEditDistance("kitten", "sitting", 0), 3);
+}
+
+// 测试并行DP - 编辑距离与单线程结果一致（尺寸不是分块的整数倍）
+TEST(ParallelDpTest, EditDistanceMatchesSerial) {
+    std::string a = randomText(5003, 'd', 481);
+    std::string b = mutate(a, 700, 482);
+    std::string c = randomText(4099, 'z', 483);
+
+    int expectedSimilar = algorithms::editDistance(a, b);
+    int expectedRandom = algorithms::editDistance(a, c);
+    for (unsigned threads : {2u, 3u, 8u}) {
+        EXPECT_EQ(algorithms::parallelEditDistance(a, b, threads), expectedSimilar) << "threads=" << threads;
+        EXPECT_EQ(algorithms::parallelEditDistance(c, a, threads), expectedRandom) << "threads=" << threads;
+    }
+}
+
+// 测试并行DP - 位向量编辑距离在字长与分块边界、字母表不重合时与朴素DP一致
+TEST(ParallelDpTest, EditDistanceBitVectorBoundaries) {
+    std::mt19937 gen(487);
+    for (std::size_t m : {1u, 63u, 64u, 65u, 255u, 256u, 257u, 700u}) {
+        for (std::size_t n : {1u, 2u, 64u, 2047u, 2048u, 2049u}) {
+            std::string a = randomText(m, static_cast<char>('a' + gen() % 6), gen());
+            std::string b = randomText(n, static_cast<char>('a' + gen() % 8), gen());
+            EXPECT_EQ(algorithms::parallelEditDistance(a, b, 1), algorithms::editDistance(a, b))
+                << "m=" << m << " n=" << n;
+        }
+    }
+    EXPECT_EQ(algorithms::parallelEditDistance(std::string(300, 'x'), std::string(200, 'y'), 1), 300);
+}
+
+// 测试并行DP - 位并行 LCS 的行块与列块之间正确传递进位
+TEST(ParallelDpTest, LongestCommonSubsequenceMatchesSerial) {
+    std::string a = randomText(30011, 'b', 484);
+    std::string b = mutate(a.substr(0, 9100), 400, 485);
+    std::string c = randomText(12000, 'z', 486);
+
+    int expectedSimilar = algorithms::longestCommonSubsequence(a, b);
+    int expectedRandom = algorithms::longestCommonSubsequence(c, a);
+    for (unsigned threads : {2u, 3u, 4u, 8u}) {
+        EXPECT_EQ(algorithms::parallelLongestCommonSubsequence(a, b, threads), expectedSimilar)
+            << "threads=" << threads;
+        EXPECT_EQ(algorithms::parallelLongestCommonSubsequence(c, a, threads), expectedRandom)
+            << "threads=" << threads;
+    }
+}
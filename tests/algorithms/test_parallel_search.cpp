@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "algorithms/parallel_search.h"
+#include "algorithms/string_algorithms.h"
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string randomText(std::size_t length, char maxLetter, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> letter('a', maxLetter);
+    std::string text(length, ' ');
+    for (char& c : text) c = static_cast<char>(letter(gen));
+    return text;
+}
+
+} // namespace
+
+// 测试并行查找 - 空输入与短文本
+TEST(ParallelSearchTest, EmptyAndShortInputs) {
+    EXPECT_EQ(algorithms::parallelCountMatches("", "a", 4), 0u);
+    EXPECT_EQ(algorithms::parallelCountMatches("abc", "", 4), 0u);
+    EXPECT_EQ(algorithms::parallelCountMatches("ab", "abc", 4), 0u);
+    EXPECT_TRUE(algorithms::parallelFindAll("abc", "", 4).empty());
+
+    // 短文本退化为单线程
+    EXPECT_EQ(algorithms::parallelFindAll("abcabc", "bc", 8), (std::vector<std::size_t>{1, 4}));
+    EXPECT_EQ(algorithms::parallelCountMatches("aaaa", "aa", 0), 3u);
+}
+
+// 测试并行查找 - 恰好跨越块边界的匹配只报告一次
+TEST(ParallelSearchTest, MatchOnChunkBoundary) {
+    std::size_t n = 4 * algorithms::PARALLEL_SEARCH_MIN_CHUNK;
+    std::string text(n, 'x');
+    std::string pattern = "needle";
+    // 两个线程时第二块从起始位置 (n - m + 1) / 2 开始，把匹配放在它的前后
+    std::size_t boundary = (n - pattern.size() + 1) / 2;
+    std::vector<std::size_t> expected = {boundary - 3, boundary + 3, boundary + 10};
+    for (std::size_t pos : expected) {
+        text.replace(pos, pattern.size(), pattern);
+    }
+
+    for (unsigned threads : {1u, 2u, 3u, 4u}) {
+        EXPECT_EQ(algorithms::parallelFindAll(text, pattern, threads), expected) << threads;
+        EXPECT_EQ(algorithms::parallelCountMatches(text, pattern, threads), expected.size());
+    }
+}
+
+// 测试并行查找 - 重叠匹配与串行结果一致
+TEST(ParallelSearchTest, MatchesSerialSearch) {
+    std::string text = randomText(6 * algorithms::PARALLEL_SEARCH_MIN_CHUNK + 123, 'b', 37);
+
+    for (const std::string& pattern : {"a", "ab", "abba", "aaaaaaa", "babababab"}) {
+        std::vector<std::size_t> expected;
+        algorithms::findMatches(text, pattern, std::back_inserter(expected));
+
+        for (unsigned threads : {2u, 5u, 6u, 16u}) {
+            EXPECT_EQ(algorithms::parallelFindAll(text, pattern, threads), expected)
+                << pattern << " threads=" << threads;
+            EXPECT_EQ(algorithms::parallelCountMatches(text, pattern, threads), expected.size());
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "algorithms/rabin_karp.h"
+#include "algorithms/aho_corasick.h"
+#include "algorithms/parallel_search.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using algorithms::PatternMatch;
+using algorithms::RabinKarpMatcher;
+
+namespace {
+
+// 辅助函数：用 Aho-Corasick 得到按（位置、编号）排序的参考结果
+std::vector<PatternMatch> referenceMatches(const std::vector<std::string>& patterns, const std::string& text) {
+    auto matches = algorithms::AhoCorasick(patterns).findAll(text);
+    std::sort(matches.begin(), matches.end(), [](const PatternMatch& a, const PatternMatch& b) {
+        if (a.position != b.position) return a.position < b.position;
+        return a.patternId < b.patternId;
+    });
+    return matches;
+}
+
+std::string randomBytes(std::mt19937& gen, std::size_t length, int alphabet) {
+    std::uniform_int_distribution<int> byte(0, alphabet - 1);
+    std::string text(length, ' ');
+    for (char& c : text) c = static_cast<char>('a' + byte(gen));
+    return text;
+}
+
+} // namespace
+
+// 测试 Rabin-Karp - 基本示例与多种长度
+TEST(RabinKarpTest, BasicMultipleLengths) {
+    RabinKarpMatcher rk({"abc", "bcd", "xy"});
+    EXPECT_EQ(rk.lengthCount(), 2u);
+    EXPECT_EQ(rk.findAll("abcdxy"), (std::vector<PatternMatch>{{0, 0}, {1, 1}, {2, 4}}));
+    EXPECT_EQ(rk.count("abcdxyabc"), 4u);
+    EXPECT_TRUE(rk.findAll("").empty());
+    EXPECT_TRUE(rk.findAll("ab").empty());
+}
+
+// 测试 Rabin-Karp - 空模式、重复模式与空模式集
+TEST(RabinKarpTest, EmptyAndDuplicatePatterns) {
+    RabinKarpMatcher rk({"", "aa", "aa"});
+    EXPECT_EQ(rk.patternCount(), 3u);
+    EXPECT_EQ(rk.findAll("aaa"), (std::vector<PatternMatch>{{1, 0}, {2, 0}, {1, 1}, {2, 1}}));
+
+    RabinKarpMatcher none({});
+    EXPECT_EQ(none.count("anything"), 0u);
+    EXPECT_EQ(none.countParallel("anything", 4), 0u);
+}
+
+// 测试 Rabin-Karp - 大量定长签名与 Aho-Corasick 结果一致
+TEST(RabinKarpTest, ManyFixedLengthSignatures) {
+    std::mt19937 gen(41);
+    std::string text = randomBytes(gen, 20000, 4);
+    std::vector<std::string> patterns;
+    for (int i = 0; i < 2000; i++) {
+        if (i % 4 == 0) {
+            patterns.push_back(text.substr(gen() % (text.size() - 32), 32));
+        } else {
+            patterns.push_back(randomBytes(gen, 32, 4));
+        }
+    }
+
+    RabinKarpMatcher rk(patterns);
+    EXPECT_EQ(rk.lengthCount(), 1u);
+    auto expected = referenceMatches(patterns, text);
+    EXPECT_GE(expected.size(), 500u);
+    EXPECT_EQ(rk.findAll(text), expected);
+    EXPECT_EQ(rk.count(text), expected.size());
+    EXPECT_LT(rk.memoryBytes(), algorithms::AhoCorasick(patterns).memoryBytes());
+}
+
+// 测试 Rabin-Karp - 多种长度的随机模式
+TEST(RabinKarpTest, RandomMixedLengths) {
+    std::mt19937 gen(411);
+    std::string text = randomBytes(gen, 5000, 3);
+    std::vector<std::string> patterns;
+    for (int i = 0; i < 300; i++) {
+        std::size_t length = 1 + gen() % 12;
+        patterns.push_back(text.substr(gen() % (text.size() - length), length));
+    }
+    EXPECT_EQ(RabinKarpMatcher(patterns).findAll(text), referenceMatches(patterns, text));
+}
+
+// 测试 Rabin-Karp - 并行模式与串行结果一致（跨块匹配只报告一次）
+TEST(RabinKarpTest, ParallelMatchesSerial) {
+    std::mt19937 gen(412);
+    std::string text = randomBytes(gen, 5 * algorithms::PARALLEL_SEARCH_MIN_CHUNK + 17, 2);
+    std::vector<std::string> patterns = {"a", "abba", "bbbbbbbbbbbbbbbb", text.substr(1000, 40)};
+
+    RabinKarpMatcher rk(patterns);
+    auto serial = rk.findAll(text);
+    for (unsigned threads : {1u, 2u, 3u, 8u}) {
+        EXPECT_EQ(rk.findAllParallel(text, threads), serial) << threads;
+        EXPECT_EQ(rk.countParallel(text, threads), serial.size());
+    }
+}
@@ -2,6 +2,8 @@
 #include "algorithms/search.h"
 #include <vector>
 #include <climits>
+#include <algorithm>
+#include <random>
 
 // 测试二分查找 - 找到目标值
 TEST(BinarySearchTest, FindTarget) {
@@ -378,4 +380,81 @@ TEST(InterpolationSearchTest, AllEqualNotFound) {
 TEST(InterpolationSearchTest, TargetInFirstHalf) {
     std::vector<int> arr = {1, 2, 3, 4, 100, 200};
     EXPECT_EQ(algorithms::interpolationSearch(arr, 2), 1);
-}
\ No newline at end of file
+}
+
+// 测试自适应插值查找 - 基本查找
+TEST(AdaptiveInterpolationSearchTest, FindTarget) {
+    std::vector<int> arr = {10, 20, 30, 40, 50, 60, 70, 80, 90, 100};
+
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 10), 0);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 50), 4);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 100), 9);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 25), -1);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 5), -1);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 105), -1);
+}
+
+// 测试自适应插值查找 - 空数组和所有元素相等
+TEST(AdaptiveInterpolationSearchTest, EmptyAndAllEqual) {
+    std::vector<int> empty;
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(empty, 1), -1);
+
+    std::vector<int> arr(1000, 7);
+    int result = algorithms::adaptiveInterpolationSearch(arr, 7);
+    ASSERT_GE(result, 0);
+    EXPECT_EQ(arr[result], 7);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 6), -1);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 8), -1);
+}
+
+// 测试自适应插值查找 - 边界值（INT_MAX, INT_MIN）
+TEST(AdaptiveInterpolationSearchTest, ExtremeValues) {
+    std::vector<int> arr = {INT_MIN, -1000, 0, 1000, INT_MAX};
+
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, INT_MIN), 0);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, INT_MAX), 4);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 0), 2);
+    EXPECT_EQ(algorithms::adaptiveInterpolationSearch(arr, 1), -1);
+}
+
+// 辅助函数：验证自适应插值查找与二分查找在存在性上一致
+static void expectAgreesWithBinarySearch(const std::vector<int>& arr, std::mt19937& gen) {
+    std::uniform_int_distribution<std::size_t> pick(0, arr.size() - 1);
+    for (int q = 0; q < 2000; q++) {
+        int target = arr[pick(gen)] + (q % 2);
+        int expected = algorithms::binarySearch(arr, target);
+        int actual = algorithms::adaptiveInterpolationSearch(arr, target);
+        if (expected == -1) {
+            ASSERT_EQ(actual, -1) << "target=" << target;
+        } else {
+            ASSERT_NE(actual, -1) << "target=" << target;
+            ASSERT_EQ(arr[actual], target);
+        }
+    }
+}
+
+// 测试自适应插值查找 - 均匀、Zipf 和聚簇分布
+TEST(AdaptiveInterpolationSearchTest, SkewedDistributions) {
+    std::mt19937 gen(2024);
+
+    std::vector<int> uniform(100000);
+    std::uniform_int_distribution<int> uniformDist(0, 1 << 30);
+    for (int& v : uniform) v = uniformDist(gen);
+    std::sort(uniform.begin(), uniform.end());
+    expectAgreesWithBinarySearch(uniform, gen);
+
+    // Zipf 风格：第 i 个值约为 C / (n - i)，尾部急剧增长
+    std::vector<int> zipf(100000);
+    for (int i = 0; i < 100000; i++) {
+        zipf[i] = static_cast<int>(2000000000.0 / (100000 - i));
+    }
+    expectAgreesWithBinarySearch(zipf, gen);
+
+    // 聚簇：少数密集簇分布在很大的取值范围中
+    std::vector<int> clustered;
+    for (int c = 0; c < 8; c++) {
+        int base = c * 250000000;
+        for (int i = 0; i < 10000; i++) clustered.push_back(base + i);
+    }
+    expectAgreesWithBinarySearch(clustered, gen);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "algorithms/sequence_lcs.h"
+#include "algorithms/dp_algorithms.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using algorithms::LcsEngine;
+
+namespace {
+
+// 朴素 O(m·n) 的 LCS 长度
+std::size_t naiveLcs(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b) {
+    std::vector<std::size_t> prev(b.size() + 1, 0), cur(b.size() + 1, 0);
+    for (std::size_t i = 1; i <= a.size(); i++) {
+        for (std::size_t j = 1; j <= b.size(); j++) {
+            cur[j] = a[i - 1] == b[j - 1] ? prev[j - 1] + 1 : std::max(prev[j], cur[j - 1]);
+        }
+        std::swap(prev, cur);
+    }
+    return prev[b.size()];
+}
+
+std::vector<std::uint32_t> randomIds(std::mt19937& gen, std::size_t length, std::uint32_t alphabet) {
+    std::vector<std::uint32_t> ids(length);
+    for (auto& id : ids) id = static_cast<std::uint32_t>(gen() % alphabet);
+    return ids;
+}
+
+} // namespace
+
+// 测试通用LCS - 两种引擎在各种字母表大小下都与朴素DP一致
+TEST(SequenceLcsTest, EnginesMatchNaive) {
+    std::mt19937 gen(501);
+    for (int round = 0; round < 200; round++) {
+        std::uint32_t alphabet = 1 + static_cast<std::uint32_t>(gen() % (round % 2 == 0 ? 4 : 500));
+        auto a = randomIds(gen, gen() % 200, alphabet);
+        auto b = randomIds(gen, gen() % 200, alphabet);
+        std::size_t expected = naiveLcs(a, b);
+        ASSERT_EQ(algorithms::lcsLength(a, b, alphabet, LcsEngine::BitParallel), expected);
+        ASSERT_EQ(algorithms::lcsLength(a, b, alphabet, LcsEngine::HuntSzymanski), expected);
+        ASSERT_EQ(algorithms::lcsLength(a, b, alphabet), expected);
+    }
+}
+
+// 测试通用LCS - 自动选择：小字母表选位并行，几乎不重复的行选 Hunt-Szymanski
+TEST(SequenceLcsTest, AutomaticEngineSelection) {
+    std::mt19937 gen(502);
+    auto dnaA = randomIds(gen, 5000, 4);
+    auto dnaB = randomIds(gen, 5000, 4);
+    EXPECT_EQ(algorithms::selectLcsEngine(dnaA, dnaB, 4), LcsEngine::BitParallel);
+
+    std::vector<std::uint32_t> linesA(20000), linesB(20000);
+    for (std::uint32_t i = 0; i < 20000; i++) {
+        linesA[i] = i;
+        linesB[i] = i % 7 == 3 ? 20000 + i : i;
+    }
+    EXPECT_EQ(algorithms::selectLcsEngine(linesA, linesB, 40000), LcsEngine::HuntSzymanski);
+    EXPECT_EQ(algorithms::lcsLength(linesA, linesB, 40000), 20000u - 20000u / 7 - (20000 % 7 > 3 ? 1 : 0));
+}
+
+// 测试通用LCS - 字符串、64 位编号和指针接口
+TEST(SequenceLcsTest, GenericTokens) {
+    std::vector<std::string> oldLines = {"a", "b", "c"};
+    std::vector<std::string> newLines = {"a", "c", "d"};
+    EXPECT_EQ(algorithms::lcs(oldLines, newLines), 2u);
+
+    std::vector<std::uint64_t> oldIds = {1ULL << 40, 3, 1ULL << 50, 9, 1ULL << 40};
+    std::vector<std::uint64_t> newIds = {3, 1ULL << 40, 9, 1ULL << 40, 1ULL << 50};
+    EXPECT_EQ(algorithms::lcs(oldIds, newIds), 3u);
+
+    std::string s1 = "ABCDGH", s2 = "AEDFHR";
+    EXPECT_EQ(algorithms::lcs(s1.data(), s1.size(), s2.data(), s2.size()),
+              static_cast<std::size_t>(algorithms::longestCommonSubsequence(s1, s2)));
+    EXPECT_EQ(algorithms::lcs(std::vector<int>{}, std::vector<int>{1, 2}), 0u);
+}
+
+// 测试通用LCS - 编号超出字母表范围
+TEST(SequenceLcsTest, InvalidIds) {
+    EXPECT_THROW(algorithms::lcsLength({0, 5}, {1}, 5), std::invalid_argument);
+    EXPECT_THROW(algorithms::lcsLength({0}, {7}, 5, LcsEngine::HuntSzymanski), std::invalid_argument);
+    EXPECT_THROW(algorithms::selectLcsEngine({0}, {5}, 5), std::invalid_argument);
+}
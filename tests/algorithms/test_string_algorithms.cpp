@@ -2,6 +2,10 @@
 #include "algorithms/string_algorithms.h"
 #include <vector>
 #include <string>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 
 // 测试KMP搜索 - 找到单个匹配
 TEST(KMPSearchTest, SingleMatch) {
@@ -142,3 +146,428 @@ TEST(ComputePrefixTableTest, NoRepeatingPattern) {
         EXPECT_EQ(val, 0);
     }
 }
+
+// 测试预编译模式 - 基本查找（KMP 路径与 Horspool 路径）
+TEST(CompiledPatternTest, FindFirstCountAndFindAll) {
+    algorithms::CompiledPattern shortPattern("aa");
+    EXPECT_EQ(shortPattern.findFirst("baaaa"), 1u);
+    EXPECT_EQ(shortPattern.count("baaaa"), 3u);
+    EXPECT_EQ(shortPattern.findAll("baaaa"), (std::vector<std::size_t>{1, 2, 3}));
+
+    algorithms::CompiledPattern longPattern("ABABCABAB");
+    EXPECT_EQ(longPattern.findFirst("ABABDABACDABABCABAB"), 10u);
+    EXPECT_EQ(longPattern.count("ABABCABABCABAB"), 2u);
+    EXPECT_EQ(longPattern.findFirst("ABABDABACD"), algorithms::CompiledPattern::npos);
+}
+
+// 测试预编译模式 - 空模式和短文本
+TEST(CompiledPatternTest, EdgeCases) {
+    algorithms::CompiledPattern empty("");
+    EXPECT_EQ(empty.findFirst("abc"), algorithms::CompiledPattern::npos);
+    EXPECT_EQ(empty.count("abc"), 0u);
+
+    algorithms::CompiledPattern pattern("abcdef");
+    EXPECT_EQ(pattern.count("abc"), 0u);
+    EXPECT_EQ(pattern.findFirst(""), algorithms::CompiledPattern::npos);
+    EXPECT_EQ(pattern.findFirst("abcdef"), 0u);
+}
+
+// 测试预编译模式 - 缓冲区复用与访问者接口
+TEST(CompiledPatternTest, BufferReuseAndVisitor) {
+    algorithms::CompiledPattern pattern("abab");
+    std::vector<std::size_t> positions;
+    pattern.findAll("abababab", positions);
+    EXPECT_EQ(positions, (std::vector<std::size_t>{0, 2, 4}));
+
+    pattern.findAll("xxabab", positions);
+    EXPECT_EQ(positions, (std::vector<std::size_t>{2}));
+
+    std::size_t sum = 0;
+    pattern.forEach("abababab", [&sum](std::size_t pos) { sum += pos; });
+    EXPECT_EQ(sum, 6u);
+}
+
+// 测试预编译模式 - 随机文本与 kmpSearch 结果一致
+TEST(CompiledPatternTest, MatchesKmpSearch) {
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> letter('a', 'c');
+    std::uniform_int_distribution<int> len(1, 8);
+
+    std::string text(3000, ' ');
+    for (char& c : text) c = static_cast<char>(letter(gen));
+
+    for (int trial = 0; trial < 200; trial++) {
+        std::string p(len(gen), ' ');
+        for (char& c : p) c = static_cast<char>(letter(gen));
+
+        algorithms::CompiledPattern pattern(p);
+        std::vector<int> expected = algorithms::kmpSearch(text, p);
+        std::vector<std::size_t> actual = pattern.findAll(text);
+
+        ASSERT_EQ(actual.size(), expected.size()) << "pattern=" << p;
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(actual[i], static_cast<std::size_t>(expected[i]));
+        }
+        EXPECT_EQ(pattern.count(text), expected.size());
+    }
+}
+
+// 测试Horspool和Two-Way - 基本示例
+TEST(SublinearSearchTest, BasicExamples) {
+    EXPECT_EQ(algorithms::horspoolSearch("here is a simple example", "example"), (std::vector<int>{17}));
+    EXPECT_EQ(algorithms::twoWaySearch("GATTACAGATTACA", "ATTA"), (std::vector<int>{1, 8}));
+    EXPECT_EQ(algorithms::twoWaySearch("aaaaa", "aa"), (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(algorithms::horspoolSearch("aaaaa", "aa"), (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_TRUE(algorithms::twoWaySearch("abc", "").empty());
+    EXPECT_TRUE(algorithms::horspoolSearch("ab", "abc").empty());
+}
+
+// 测试算法自动选择
+TEST(SublinearSearchTest, SelectAlgorithm) {
+    using algorithms::StringSearchAlgorithm;
+    EXPECT_EQ(algorithms::selectSearchAlgorithm("abc"), StringSearchAlgorithm::Horspool);
+    EXPECT_EQ(algorithms::selectSearchAlgorithm("aab"), StringSearchAlgorithm::Horspool);
+    EXPECT_EQ(algorithms::selectSearchAlgorithm("ACGTTGCAACGT"), StringSearchAlgorithm::Horspool);
+    EXPECT_EQ(algorithms::selectSearchAlgorithm("aaaabaaa"), StringSearchAlgorithm::TwoWay);
+    EXPECT_EQ(algorithms::selectSearchAlgorithm("the quick brown fox"), StringSearchAlgorithm::Horspool);
+    EXPECT_EQ(algorithms::selectSearchAlgorithm(std::string(64, 'a') + "bcdef"),
+              StringSearchAlgorithm::TwoWay);
+}
+
+// 辅助函数：在给定字母表上生成随机文本/模式，验证所有算法与 kmpSearch 一致
+static void checkAllAlgorithmsAgree(const std::string& alphabet, std::size_t minLen,
+                                    std::size_t maxLen, unsigned seed) {
+    using algorithms::StringSearchAlgorithm;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+    std::uniform_int_distribution<std::size_t> len(minLen, maxLen);
+
+    std::string text(4000, ' ');
+    for (char& c : text) c = alphabet[pick(gen)];
+
+    for (int trial = 0; trial < 100; trial++) {
+        std::string pattern(len(gen), ' ');
+        if (trial % 3 == 0) {
+            // 从文本中截取，保证至少一次匹配
+            std::size_t start = gen() % (text.size() - pattern.size());
+            pattern = text.substr(start, pattern.size());
+        } else {
+            for (char& c : pattern) c = alphabet[pick(gen)];
+        }
+
+        std::vector<int> expected = algorithms::kmpSearch(text, pattern);
+        ASSERT_EQ(algorithms::horspoolSearch(text, pattern), expected) << pattern;
+        ASSERT_EQ(algorithms::twoWaySearch(text, pattern), expected) << pattern;
+        ASSERT_EQ(algorithms::stringSearch(text, pattern), expected) << pattern;
+        ASSERT_EQ(algorithms::stringSearch(text, pattern, StringSearchAlgorithm::KMP), expected);
+    }
+}
+
+// 测试Horspool和Two-Way - 英文文本、DNA与二进制数据
+TEST(SublinearSearchTest, MatchesKmpOnDifferentAlphabets) {
+    checkAllAlgorithmsAgree("abcdefghijklmnopqrstuvwxyz ", 1, 20, 1);
+    checkAllAlgorithmsAgree("ACGT", 1, 30, 2);
+    checkAllAlgorithmsAgree(std::string("\x00\x01", 2), 1, 40, 3);
+}
+
+// 测试Two-Way - 高度周期性的模式
+TEST(SublinearSearchTest, PeriodicPatterns) {
+    std::string text;
+    for (int i = 0; i < 200; i++) text += "abaab";
+    for (const std::string& pattern : {"abaababaab", "aab", "abaabaab", "baabab"}) {
+        EXPECT_EQ(algorithms::twoWaySearch(text, pattern), algorithms::kmpSearch(text, pattern)) << pattern;
+    }
+
+    std::string zeros(1000, 'a');
+    EXPECT_EQ(algorithms::twoWaySearch(zeros, std::string(10, 'a')).size(), 991u);
+}
+
+// 测试向量化查找 - 基本示例
+TEST(SimdSearchTest, BasicExamples) {
+    EXPECT_EQ(algorithms::simdSearch("abcabcabc", "cab"), (std::vector<int>{2, 5}));
+    EXPECT_EQ(algorithms::simdSearch("AAAAA", "AA"), (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(algorithms::simdSearch("xyz", "y"), (std::vector<int>{1}));
+    EXPECT_TRUE(algorithms::simdSearch("abc", "").empty());
+    EXPECT_TRUE(algorithms::simdSearch("ab", "abc").empty());
+}
+
+// 测试向量化查找 - 每个指令集级别都与 kmpSearch 一致（跨越向量块边界）
+TEST(SimdSearchTest, AllLevelsMatchKmp) {
+    using algorithms::SimdLevel;
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int> letter('a', 'c');
+    std::uniform_int_distribution<int> len(1, 70);
+
+    for (int trial = 0; trial < 150; trial++) {
+        std::string text(static_cast<std::size_t>(trial * 7 + 1), ' ');
+        for (char& c : text) c = static_cast<char>(letter(gen));
+        std::string pattern(static_cast<std::size_t>(len(gen) % 6 + 1), ' ');
+        for (char& c : pattern) c = static_cast<char>(letter(gen));
+        if (trial % 10 == 0) pattern = std::string(static_cast<std::size_t>(len(gen)), 'a');
+
+        std::vector<int> expected = algorithms::kmpSearch(text, pattern);
+        for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+            ASSERT_EQ(algorithms::simdSearch(text, pattern, level), expected)
+                << "level=" << static_cast<int>(level) << " pattern=" << pattern;
+        }
+        ASSERT_EQ(algorithms::simdSearch(text, pattern), expected);
+    }
+}
+
+// 测试流式匹配 - 跨块边界的匹配
+TEST(StreamingMatcherTest, MatchAcrossChunkBoundary) {
+    std::vector<std::uint64_t> offsets;
+    algorithms::StreamingMatcher matcher("needle", [&](std::uint64_t pos) { offsets.push_back(pos); });
+
+    matcher.feed("hay nee", 7);
+    matcher.feed("dle hay", 7);
+    matcher.feed(std::string_view("needle"));
+
+    EXPECT_EQ(offsets, (std::vector<std::uint64_t>{4, 14}));
+    EXPECT_EQ(matcher.bytesConsumed(), 20u);
+    EXPECT_EQ(matcher.matchCount(), 2u);
+}
+
+// 测试流式匹配 - 重置与空模式
+TEST(StreamingMatcherTest, ResetAndEmptyPattern) {
+    std::vector<std::uint64_t> offsets;
+    algorithms::StreamingMatcher matcher("aba", [&](std::uint64_t pos) { offsets.push_back(pos); });
+    matcher.feed("ab", 2);
+    matcher.reset();
+    matcher.feed("a", 1);
+    EXPECT_TRUE(offsets.empty());
+    EXPECT_EQ(matcher.bytesConsumed(), 1u);
+
+    algorithms::StreamingMatcher empty("", [&](std::uint64_t pos) { offsets.push_back(pos); });
+    empty.feed("abc", 3);
+    EXPECT_TRUE(offsets.empty());
+    EXPECT_EQ(empty.bytesConsumed(), 3u);
+}
+
+// 测试流式匹配 - 任意分块方式结果都与整体 kmpSearch 一致
+TEST(StreamingMatcherTest, ArbitraryChunkingMatchesKmp) {
+    std::mt19937 gen(23);
+    std::uniform_int_distribution<int> letter('a', 'b');
+    std::string text(2000, ' ');
+    for (char& c : text) c = static_cast<char>(letter(gen));
+
+    for (const std::string& pattern : {"a", "ab", "abab", "aabba", "bbbbb"}) {
+        std::vector<int> expected = algorithms::kmpSearch(text, pattern);
+
+        for (std::size_t chunk : {1u, 2u, 3u, 7u, 64u, 5000u}) {
+            std::vector<std::uint64_t> offsets;
+            algorithms::StreamingMatcher matcher(pattern, [&](std::uint64_t pos) { offsets.push_back(pos); });
+            for (std::size_t pos = 0; pos < text.size(); pos += chunk) {
+                matcher.feed(text.data() + pos, std::min(chunk, text.size() - pos));
+            }
+
+            ASSERT_EQ(offsets.size(), expected.size()) << pattern << " chunk=" << chunk;
+            for (std::size_t i = 0; i < expected.size(); i++) {
+                ASSERT_EQ(offsets[i], static_cast<std::uint64_t>(expected[i]));
+            }
+        }
+    }
+}
+
+// 测试零拷贝接口 - 访问器与输出迭代器
+TEST(ZeroCopySearchTest, VisitorAndOutputIterator) {
+    std::string_view text = "abcabcabc";
+    std::vector<std::size_t> visited;
+    algorithms::forEachMatch(text, "cab", [&](std::size_t pos) { visited.push_back(pos); });
+    EXPECT_EQ(visited, (std::vector<std::size_t>{2, 5}));
+
+    std::size_t buffer[4] = {0, 0, 0, 0};
+    std::size_t* end = algorithms::findMatches(text, "abc", buffer);
+    ASSERT_EQ(end - buffer, 3);
+    EXPECT_EQ(buffer[0], 0u);
+    EXPECT_EQ(buffer[1], 3u);
+    EXPECT_EQ(buffer[2], 6u);
+
+    // 子视图：位置相对于视图起点
+    std::vector<std::size_t> sub;
+    algorithms::findMatches(text.substr(1, 6), "ca", std::back_inserter(sub));
+    EXPECT_EQ(sub, (std::vector<std::size_t>{1, 4}));
+}
+
+// 测试零拷贝接口 - 计数、首个匹配与提前停止
+TEST(ZeroCopySearchTest, CountAndFirstMatch) {
+    const char raw[] = "aaaa\0aaa";
+    EXPECT_EQ(algorithms::countMatches(raw, 8, "aa", 2), 5u);
+    EXPECT_EQ(algorithms::countMatches("aaaa", "aa"), 3u);
+    EXPECT_EQ(algorithms::countMatches("abc", ""), 0u);
+    EXPECT_EQ(algorithms::countMatches("ab", "abc"), 0u);
+
+    EXPECT_EQ(algorithms::findFirstMatch("hello world", "o"), 4u);
+    EXPECT_EQ(algorithms::findFirstMatch("hello world", "xyz"), std::string_view::npos);
+    EXPECT_EQ(algorithms::findFirstMatch("hello", ""), std::string_view::npos);
+
+    std::size_t calls = 0;
+    algorithms::forEachMatch("aaaaaa", "a", [&](std::size_t) { return ++calls < 2; });
+    EXPECT_EQ(calls, 2u);
+}
+
+// 测试零拷贝接口 - 与 kmpSearch 结果一致
+TEST(ZeroCopySearchTest, MatchesKmpOnRandomText) {
+    std::mt19937 gen(36);
+    std::uniform_int_distribution<int> letter('a', 'c');
+    std::string text(3000, ' ');
+    for (char& c : text) c = static_cast<char>(letter(gen));
+
+    for (const std::string& pattern : {"a", "ab", "cab", "abcabc", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"}) {
+        std::vector<int> expected = algorithms::kmpSearch(text, pattern);
+        std::vector<std::size_t> actual;
+        algorithms::findMatches(text, pattern, std::back_inserter(actual));
+
+        ASSERT_EQ(actual.size(), expected.size()) << pattern;
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            EXPECT_EQ(actual[i], static_cast<std::size_t>(expected[i]));
+        }
+        EXPECT_EQ(algorithms::countMatches(text, pattern), expected.size());
+        EXPECT_EQ(algorithms::findFirstMatch(text, pattern),
+                  expected.empty() ? std::string_view::npos : static_cast<std::size_t>(expected[0]));
+    }
+}
+
+namespace {
+
+// 辅助函数：朴素计算以每个位置结尾的最小编辑距离（Sellers 算法）
+std::vector<algorithms::ApproximateMatch> naiveEditMatches(const std::string& text, const std::string& pattern,
+                                                           std::size_t k) {
+    std::size_t m = pattern.size();
+    std::vector<std::size_t> column(m + 1);
+    for (std::size_t i = 0; i <= m; i++) column[i] = i;
+    std::vector<algorithms::ApproximateMatch> result;
+    for (std::size_t j = 0; j < text.size(); j++) {
+        std::size_t diagonal = column[0];
+        column[0] = 0;
+        for (std::size_t i = 1; i <= m; i++) {
+            std::size_t up = column[i];
+            column[i] = std::min({column[i] + 1, column[i - 1] + 1,
+                                  diagonal + (pattern[i - 1] == text[j] ? 0 : 1)});
+            diagonal = up;
+        }
+        if (m > 0 && column[m] <= k) result.push_back({j, column[m]});
+    }
+    return result;
+}
+
+// 辅助函数：朴素计算每个起点的不匹配数
+std::vector<algorithms::ApproximateMatch> naiveMismatchMatches(const std::string& text, const std::string& pattern,
+                                                               std::size_t k) {
+    std::vector<algorithms::ApproximateMatch> result;
+    std::size_t m = pattern.size();
+    for (std::size_t i = 0; m > 0 && i + m <= text.size(); i++) {
+        std::size_t errors = 0;
+        for (std::size_t j = 0; j < m; j++) errors += text[i + j] != pattern[j];
+        if (errors <= k) result.push_back({i, errors});
+    }
+    return result;
+}
+
+std::string randomLetters(std::mt19937& gen, std::size_t length, char maxLetter) {
+    std::uniform_int_distribution<int> letter('a', maxLetter);
+    std::string text(length, ' ');
+    for (char& c : text) c = static_cast<char>(letter(gen));
+    return text;
+}
+
+} // namespace
+
+// 测试 Shift-Or 近似匹配 - 基本示例
+TEST(ShiftOrMatcherTest, BasicMismatches) {
+    auto matches = algorithms::findMismatchMatches("jello help hello", "hello", 1);
+    EXPECT_EQ(matches, (std::vector<algorithms::ApproximateMatch>{{0, 1}, {11, 0}}));
+
+    EXPECT_EQ(algorithms::findMismatchMatches("abc", "", 1).size(), 0u);
+    EXPECT_EQ(algorithms::findMismatchMatches("ab", "abc", 3).size(), 0u);
+    // k >= m 时每个完整窗口都匹配
+    EXPECT_EQ(algorithms::findMismatchMatches("xyzw", "ab", 2).size(), 3u);
+}
+
+// 测试 Shift-Or 近似匹配 - 与朴素算法对比（包括超过 64 个字符的模式）
+TEST(ShiftOrMatcherTest, MatchesNaive) {
+    std::mt19937 gen(40);
+    for (std::size_t m : {1u, 5u, 63u, 64u, 65u, 130u}) {
+        for (std::size_t k : {0u, 1u, 3u, 40u}) {
+            std::string text = randomLetters(gen, 600, 'b');
+            std::string pattern = randomLetters(gen, m, 'b');
+            EXPECT_EQ(algorithms::findMismatchMatches(text, pattern, k), naiveMismatchMatches(text, pattern, k))
+                << "m=" << m << " k=" << k;
+        }
+    }
+}
+
+// 测试 Shift-Or 近似匹配 - 分块输入
+TEST(ShiftOrMatcherTest, StreamingAcrossChunks) {
+    std::mt19937 gen(401);
+    std::string text = randomLetters(gen, 1000, 'c');
+    std::string pattern = text.substr(500, 70);
+    pattern[3] = 'z';
+    auto expected = naiveMismatchMatches(text, pattern, 2);
+    ASSERT_FALSE(expected.empty());
+
+    algorithms::ShiftOrMatcher matcher(pattern, 2);
+    std::vector<algorithms::ApproximateMatch> actual;
+    for (std::size_t pos = 0; pos < text.size(); pos += 37) {
+        matcher.feed(text.data() + pos, std::min<std::size_t>(37, text.size() - pos),
+                     [&](std::uint64_t start, std::size_t errors) {
+                         actual.push_back({static_cast<std::size_t>(start), errors});
+                     });
+    }
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(matcher.bytesConsumed(), text.size());
+
+    matcher.reset();
+    EXPECT_EQ(matcher.bytesConsumed(), 0u);
+}
+
+// 测试 Myers 近似匹配 - 基本示例
+TEST(MyersMatcherTest, BasicEditDistance) {
+    auto matches = algorithms::findEditMatches("surgery", "survey", 2);
+    EXPECT_EQ(matches, naiveEditMatches("surgery", "survey", 2));
+    EXPECT_EQ(matches, (std::vector<algorithms::ApproximateMatch>{{4, 2}, {5, 2}, {6, 2}}));
+
+    // 精确匹配的结束位置距离为 0
+    auto exact = algorithms::findEditMatches("xxabcxx", "abc", 0);
+    EXPECT_EQ(exact, (std::vector<algorithms::ApproximateMatch>{{4, 0}}));
+    EXPECT_TRUE(algorithms::findEditMatches("abc", "", 1).empty());
+}
+
+// 测试 Myers 近似匹配 - 与朴素动态规划对比（单字与分块）
+TEST(MyersMatcherTest, MatchesNaive) {
+    std::mt19937 gen(402);
+    for (std::size_t m : {1u, 7u, 63u, 64u, 65u, 128u, 200u}) {
+        for (std::size_t k : {0u, 2u, 10u, 300u}) {
+            std::string text = randomLetters(gen, 500, 'c');
+            std::string pattern = randomLetters(gen, m, 'c');
+            if (m < text.size() && k % 2 == 0) {
+                // 植入一个近似出现
+                std::string planted = pattern;
+                planted[planted.size() / 2] = 'a';
+                text.replace(100, planted.size(), planted);
+            }
+            EXPECT_EQ(algorithms::findEditMatches(text, pattern, k), naiveEditMatches(text, pattern, k))
+                << "m=" << m << " k=" << k;
+        }
+    }
+}
+
+// 测试 Myers 近似匹配 - 分块输入
+TEST(MyersMatcherTest, StreamingAcrossChunks) {
+    std::mt19937 gen(403);
+    std::string text = randomLetters(gen, 2000, 'd');
+    std::string pattern = text.substr(1200, 90);
+    pattern.erase(10, 2);
+    auto expected = naiveEditMatches(text, pattern, 3);
+    ASSERT_FALSE(expected.empty());
+
+    algorithms::MyersMatcher matcher(pattern, 3);
+    std::vector<algorithms::ApproximateMatch> actual;
+    for (std::size_t pos = 0; pos < text.size(); pos += 100) {
+        matcher.feed(text.data() + pos, std::min<std::size_t>(100, text.size() - pos),
+                     [&](std::uint64_t end, std::size_t distance) {
+                         actual.push_back({static_cast<std::size_t>(end), distance});
+                     });
+    }
+    EXPECT_EQ(actual, expected);
+}
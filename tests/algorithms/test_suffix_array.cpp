@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "algorithms/suffix_array.h"
+#include "algorithms/string_algorithms.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using algorithms::SuffixArray;
+
+namespace {
+
+// 辅助函数：朴素排序得到的后缀数组
+std::vector<std::uint32_t> naiveSuffixArray(const std::string& text) {
+    std::vector<std::uint32_t> sa(text.size());
+    for (std::size_t i = 0; i < sa.size(); i++) sa[i] = static_cast<std::uint32_t>(i);
+    std::sort(sa.begin(), sa.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return text.compare(a, std::string::npos, text, b, std::string::npos) < 0;
+    });
+    return sa;
+}
+
+std::vector<std::size_t> toSizeT(const std::vector<int>& positions) {
+    return std::vector<std::size_t>(positions.begin(), positions.end());
+}
+
+} // namespace
+
+// 测试后缀数组 - 经典示例
+TEST(SuffixArrayTest, Banana) {
+    SuffixArray index("banana");
+    EXPECT_EQ(index.suffixes(), (std::vector<std::uint32_t>{5, 3, 1, 0, 4, 2}));
+    EXPECT_EQ(index.lcp(), (std::vector<std::uint32_t>{0, 1, 3, 0, 0, 2}));
+
+    EXPECT_EQ(index.count("ana"), 2u);
+    EXPECT_EQ(index.locate("ana"), (std::vector<std::size_t>{1, 3}));
+    EXPECT_EQ(index.count("a"), 3u);
+    EXPECT_EQ(index.count("banana"), 1u);
+    EXPECT_EQ(index.count("bananas"), 0u);
+    EXPECT_EQ(index.count("nab"), 0u);
+    EXPECT_TRUE(index.contains("nan"));
+    EXPECT_EQ(index.longestRepeatedSubstring(), "ana");
+}
+
+// 测试后缀数组 - 空文本与空模式
+TEST(SuffixArrayTest, EmptyInputs) {
+    SuffixArray empty("");
+    EXPECT_EQ(empty.size(), 0u);
+    EXPECT_TRUE(empty.suffixes().empty());
+    EXPECT_EQ(empty.count("a"), 0u);
+    EXPECT_TRUE(empty.longestRepeatedSubstring().empty());
+
+    SuffixArray index("abc");
+    EXPECT_EQ(index.count(""), 0u);
+    EXPECT_TRUE(index.locate("").empty());
+    EXPECT_TRUE(index.longestRepeatedSubstring().empty());
+}
+
+// 测试后缀数组 - 随机文本与朴素构建、kmpSearch 对比
+TEST(SuffixArrayTest, MatchesNaiveConstruction) {
+    std::mt19937 gen(38);
+    for (int maxLetter : {'a', 'b', 'd', 'z'}) {
+        for (std::size_t length : {1u, 2u, 9u, 10u, 37u, 500u, 3000u}) {
+            std::uniform_int_distribution<int> letter('a', maxLetter);
+            std::string text(length, ' ');
+            for (char& c : text) c = static_cast<char>(letter(gen));
+
+            SuffixArray index(text);
+            ASSERT_EQ(index.suffixes(), naiveSuffixArray(text)) << text.substr(0, 50);
+
+            for (int q = 0; q < 20; q++) {
+                std::size_t start = gen() % length;
+                std::size_t len = 1 + gen() % std::min<std::size_t>(8, length - start);
+                std::string pattern = text.substr(start, len);
+                if (q % 4 == 0) pattern.back() = static_cast<char>(letter(gen));
+                EXPECT_EQ(index.locate(pattern), toSizeT(algorithms::kmpSearch(text, pattern)));
+            }
+        }
+    }
+}
+
+// 测试后缀数组 - 非 ASCII 字节与全相同字符
+TEST(SuffixArrayTest, BinaryAndRepetitiveText) {
+    std::string text("\xff\0\x80\xff\0\x80\x01", 7);
+    SuffixArray binary(text);
+    EXPECT_EQ(binary.suffixes(), naiveSuffixArray(text));
+    EXPECT_EQ(binary.count(std::string("\xff\0", 2)), 2u);
+
+    SuffixArray same(std::string(1000, 'a'));
+    EXPECT_EQ(same.count("aaa"), 998u);
+    EXPECT_EQ(same.longestRepeatedSubstring().size(), 999u);
+}
+
+// 测试后缀数组 - 保存与加载
+TEST(SuffixArrayTest, SaveAndLoad) {
+    std::string path = ::testing::TempDir() + "suffix_array.idx";
+    SuffixArray original("mississippi");
+    original.save(path);
+
+    SuffixArray loaded = SuffixArray::load(path);
+    EXPECT_EQ(loaded.text(), original.text());
+    EXPECT_EQ(loaded.suffixes(), original.suffixes());
+    EXPECT_EQ(loaded.lcp(), original.lcp());
+    EXPECT_EQ(loaded.locate("ssi"), (std::vector<std::size_t>{2, 5}));
+    EXPECT_EQ(loaded.longestRepeatedSubstring(), "issi");
+    std::remove(path.c_str());
+}
+
+// 测试后缀数组 - 加载错误的文件
+TEST(SuffixArrayTest, LoadInvalidFile) {
+    EXPECT_THROW(SuffixArray::load(::testing::TempDir() + "missing_suffix_array.idx"), std::runtime_error);
+
+    std::string path = ::testing::TempDir() + "bad_suffix_array.idx";
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "not an index";
+    }
+    EXPECT_THROW(SuffixArray::load(path), std::runtime_error);
+
+    // 截断的文件
+    SuffixArray("abracadabra").save(path);
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 5));
+    }
+    EXPECT_THROW(SuffixArray::load(path), std::runtime_error);
+
+    // 头部声称的长度远超文件大小：在分配内存之前拒绝
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        const char header[] = {'S', 'A', 'I', 'X', 1, 0, 0, 0, '\xff', '\xff', '\xff', 0x7f};
+        out.write(header, sizeof(header));
+        out << "tiny";
+    }
+    EXPECT_THROW(SuffixArray::load(path), std::runtime_error);
+    std::remove(path.c_str());
+}
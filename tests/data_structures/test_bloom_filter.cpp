@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "data_structures/bloom_filter.h"
+#include "data_structures/exceptions.h"
+#include <string>
+#include <vector>
+
+using data_structures::BlockedBloomFilter;
+
+// ==================== 基本操作测试 ====================
+
+TEST(BloomFilterTest, InsertedKeysAreAlwaysFound) {
+    BlockedBloomFilter<int> filter(1000);
+    for (int i = 0; i < 1000; i++) {
+        filter.insert(i * 7);
+    }
+
+    EXPECT_EQ(filter.size(), 1000u);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_TRUE(filter.mayContain(i * 7));
+    }
+}
+
+TEST(BloomFilterTest, EmptyFilterRejectsEverything) {
+    BlockedBloomFilter<int> filter(100);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_FALSE(filter.mayContain(i));
+    }
+    EXPECT_DOUBLE_EQ(filter.estimatedFalsePositiveRate(), 0.0);
+}
+
+TEST(BloomFilterTest, InvalidBitsPerKeyThrows) {
+    EXPECT_THROW(BlockedBloomFilter<int>(10, 0.0), data_structures::InvalidOperationException);
+    EXPECT_THROW(BlockedBloomFilter<int>(10, -1.0), data_structures::InvalidOperationException);
+}
+
+TEST(BloomFilterTest, ClearResetsFilter) {
+    BlockedBloomFilter<std::string> filter(10);
+    filter.insert("alpha");
+    ASSERT_TRUE(filter.mayContain("alpha"));
+
+    filter.clear();
+    EXPECT_EQ(filter.size(), 0u);
+    EXPECT_FALSE(filter.mayContain("alpha"));
+}
+
+// ==================== 构建方式测试 ====================
+
+TEST(BloomFilterTest, FromSortedVector) {
+    std::vector<int> sorted = {1, 3, 3, 3, 5, 7, 9};
+    auto filter = BlockedBloomFilter<int>::fromSortedVector(sorted, 16.0);
+
+    EXPECT_EQ(filter.size(), 5u);  // 重复键只插入一次
+    for (int key : sorted) {
+        EXPECT_TRUE(filter.mayContain(key));
+    }
+}
+
+TEST(BloomFilterTest, FromBTreeMap) {
+    data_structures::BTreeMap<int, std::string> map;
+    for (int i = 0; i < 200; i++) {
+        map.insert(i * 3, std::to_string(i));
+    }
+    auto filter = BlockedBloomFilter<int>::fromBTreeMap(map, 12.0);
+
+    EXPECT_EQ(filter.size(), map.size());
+    for (int i = 0; i < 200; i++) {
+        EXPECT_TRUE(filter.mayContain(i * 3));
+    }
+}
+
+TEST(BloomFilterTest, FromRange) {
+    std::vector<std::string> words = {"apple", "banana", "cherry"};
+    auto filter = BlockedBloomFilter<std::string>::fromRange(words.begin(), words.end());
+
+    for (const auto& w : words) {
+        EXPECT_TRUE(filter.mayContain(w));
+    }
+}
+
+// ==================== 批量查询与假阳性率测试 ====================
+
+TEST(BloomFilterTest, BatchMatchesSingleQueries) {
+    std::vector<int> keys;
+    for (int i = 0; i < 5000; i++) keys.push_back(i * 2);
+    auto filter = BlockedBloomFilter<int>::fromSortedVector(keys, 10.0);
+
+    std::vector<int> queries;
+    for (int i = 0; i < 1000; i++) queries.push_back(i * 5);
+    std::vector<std::uint8_t> result;
+    std::size_t maybe = filter.mayContainBatch(queries, result);
+
+    ASSERT_EQ(result.size(), queries.size());
+    std::size_t expectedMaybe = 0;
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        EXPECT_EQ(result[i] != 0, filter.mayContain(queries[i]));
+        expectedMaybe += result[i];
+    }
+    EXPECT_EQ(maybe, expectedMaybe);
+}
+
+TEST(BloomFilterTest, MeasuredFalsePositiveRate) {
+    const int n = 100000;
+    BlockedBloomFilter<int> filter(n, 10.0);
+    for (int i = 0; i < n; i++) {
+        filter.insert(i);
+    }
+
+    // 查询从未插入的键，统计实际假阳性率
+    int falsePositives = 0;
+    const int probes = 100000;
+    for (int i = 0; i < probes; i++) {
+        if (filter.mayContain(n + i)) falsePositives++;
+    }
+    double measured = static_cast<double>(falsePositives) / probes;
+
+    // 10 位/键的分块布隆过滤器理论值约 1%，这里留出余量
+    EXPECT_LT(measured, 0.03);
+    EXPECT_NEAR(filter.estimatedFalsePositiveRate(), measured, 0.01);
+}
+
+TEST(BloomFilterTest, MoreBitsPerKeyLowersFalsePositiveRate) {
+    const int n = 50000;
+    BlockedBloomFilter<int> small(n, 6.0);
+    BlockedBloomFilter<int> large(n, 16.0);
+    for (int i = 0; i < n; i++) {
+        small.insert(i);
+        large.insert(i);
+    }
+
+    EXPECT_LT(small.sizeInBytes(), large.sizeInBytes());
+    EXPECT_LT(large.estimatedFalsePositiveRate(), small.estimatedFalsePositiveRate());
+}